@@ -60,47 +60,47 @@ void AlarmControlPanel::publish_state(AlarmControlPanelState state) {
   }
 }
 
-void AlarmControlPanel::add_on_state_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_state_callback(InlineFunction<void()> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_triggered_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_triggered_callback(InlineFunction<void()> &&callback) {
   this->triggered_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_arming_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_arming_callback(InlineFunction<void()> &&callback) {
   this->arming_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_armed_home_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_armed_home_callback(InlineFunction<void()> &&callback) {
   this->armed_home_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_armed_night_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_armed_night_callback(InlineFunction<void()> &&callback) {
   this->armed_night_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_armed_away_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_armed_away_callback(InlineFunction<void()> &&callback) {
   this->armed_away_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_pending_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_pending_callback(InlineFunction<void()> &&callback) {
   this->pending_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_disarmed_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_disarmed_callback(InlineFunction<void()> &&callback) {
   this->disarmed_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_cleared_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_cleared_callback(InlineFunction<void()> &&callback) {
   this->cleared_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_chime_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_chime_callback(InlineFunction<void()> &&callback) {
   this->chime_callback_.add(std::move(callback));
 }
 
-void AlarmControlPanel::add_on_ready_callback(std::function<void()> &&callback) {
+void AlarmControlPanel::add_on_ready_callback(InlineFunction<void()> &&callback) {
   this->ready_callback_.add(std::move(callback));
 }
 
@@ -39,67 +39,67 @@ class AlarmControlPanel : public EntityBase {
    *
    * @param callback The callback function
    */
-  void add_on_state_callback(std::function<void()> &&callback);
+  void add_on_state_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when the state of the alarm_control_panel chanes to triggered
    *
    * @param callback The callback function
    */
-  void add_on_triggered_callback(std::function<void()> &&callback);
+  void add_on_triggered_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when the state of the alarm_control_panel chanes to arming
    *
    * @param callback The callback function
    */
-  void add_on_arming_callback(std::function<void()> &&callback);
+  void add_on_arming_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when the state of the alarm_control_panel changes to pending
    *
    * @param callback The callback function
    */
-  void add_on_pending_callback(std::function<void()> &&callback);
+  void add_on_pending_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when the state of the alarm_control_panel changes to armed_home
    *
    * @param callback The callback function
    */
-  void add_on_armed_home_callback(std::function<void()> &&callback);
+  void add_on_armed_home_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when the state of the alarm_control_panel changes to armed_night
    *
    * @param callback The callback function
    */
-  void add_on_armed_night_callback(std::function<void()> &&callback);
+  void add_on_armed_night_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when the state of the alarm_control_panel changes to armed_away
    *
    * @param callback The callback function
    */
-  void add_on_armed_away_callback(std::function<void()> &&callback);
+  void add_on_armed_away_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when the state of the alarm_control_panel changes to disarmed
    *
    * @param callback The callback function
    */
-  void add_on_disarmed_callback(std::function<void()> &&callback);
+  void add_on_disarmed_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when the state of the alarm_control_panel clears from triggered
    *
    * @param callback The callback function
    */
-  void add_on_cleared_callback(std::function<void()> &&callback);
+  void add_on_cleared_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when a chime zone goes from closed to open
    *
    * @param callback The callback function
    */
-  void add_on_chime_callback(std::function<void()> &&callback);
+  void add_on_chime_callback(InlineFunction<void()> &&callback);
 
   /** Add a callback for when a ready state changes
    *
    * @param callback The callback function
    */
-  void add_on_ready_callback(std::function<void()> &&callback);
+  void add_on_ready_callback(InlineFunction<void()> &&callback);
 
   /** A numeric representation of the supported features as per HomeAssistant
    *
@@ -2,7 +2,9 @@
 #ifdef USE_API
 #include <cerrno>
 #include <cinttypes>
+#include <cstring>
 #include <utility>
+#include <vector>
 #include "esphome/components/network/util.h"
 #include "esphome/core/entity_base.h"
 #include "esphome/core/hal.h"
@@ -27,6 +29,9 @@ namespace api {
 
 static const char *const TAG = "api.connection";
 static const int ESP32_CAMERA_STOP_STREAM = 5000;
+/// The state batch is sent early once its messages take this many bytes, and refuses new entities if that fails.
+static const uint32_t MAX_STATE_BATCH_SIZE = 1024;
+static const size_t MIN_STATE_BATCH_INDEX_SIZE = 16;
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
     : parent_(parent), initial_state_iterator_(this), list_entities_iterator_(this) {
@@ -94,7 +99,7 @@ void APIConnection::loop() {
     return;
   }
   ReadPacketBuffer buffer;
-  err = this->helper_->read_packet(&buffer);
+  err = this->helper_->can_read() ? this->helper_->read_packet(&buffer) : APIError::WOULD_BLOCK;
   if (err == APIError::WOULD_BLOCK) {
     // pass
   } else if (err != APIError::OK) {
@@ -119,6 +124,13 @@ void APIConnection::loop() {
   this->list_entities_iterator_.advance();
   this->initial_state_iterator_.advance();
 
+  if (!this->state_batch_.empty() && millis() - this->state_batch_start_ >= this->parent_->get_batch_delay())
+    this->flush_state_batch_();
+#ifdef USE_COMPONENT_PROFILING
+  if (this->profile_at_ >= 0)
+    this->send_component_profiles_();
+#endif
+
   static uint32_t keepalive = 60000;
   static uint8_t max_ping_retries = 60;
   static uint16_t ping_retry_interval = 1000;
@@ -152,7 +164,8 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
     uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
+    // key, data and done fields with their keys and the length of data
+    auto buffer = this->create_buffer(to_send + 12);
     // fixed32 key = 1;
     buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
     // bytes data = 2;
@@ -214,7 +227,7 @@ bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary
   resp.key = binary_sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !binary_sensor->has_state();
-  return this->send_binary_sensor_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_sensor) {
   ListEntitiesBinarySensorResponse msg;
@@ -246,7 +259,7 @@ bool APIConnection::send_cover_state(cover::Cover *cover) {
   if (traits.get_supports_tilt())
     resp.tilt = cover->tilt;
   resp.current_operation = static_cast<enums::CoverOperation>(cover->current_operation);
-  return this->send_cover_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_cover_info(cover::Cover *cover) {
   auto traits = cover->get_traits();
@@ -313,7 +326,7 @@ bool APIConnection::send_fan_state(fan::Fan *fan) {
     resp.direction = static_cast<enums::FanDirection>(fan->direction);
   if (traits.supports_preset_modes())
     resp.preset_mode = fan->preset_mode;
-  return this->send_fan_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_fan_info(fan::Fan *fan) {
   auto traits = fan->get_traits();
@@ -380,7 +393,7 @@ bool APIConnection::send_light_state(light::LightState *light) {
   resp.warm_white = values.get_warm_white();
   if (light->supports_effects())
     resp.effect = light->get_effect_name();
-  return this->send_light_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_light_info(light::LightState *light) {
   auto traits = light->get_traits();
@@ -463,7 +476,7 @@ bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
   resp.key = sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !sensor->has_state();
-  return this->send_sensor_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
   ListEntitiesSensorResponse msg;
@@ -494,7 +507,7 @@ bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
   resp.state = state;
-  return this->send_switch_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
   ListEntitiesSwitchResponse msg;
@@ -532,7 +545,7 @@ bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor,
   resp.key = text_sensor->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text_sensor->has_state();
-  return this->send_text_sensor_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor) {
   ListEntitiesTextSensorResponse msg;
@@ -583,7 +596,7 @@ bool APIConnection::send_climate_state(climate::Climate *climate) {
     resp.current_humidity = climate->current_humidity;
   if (traits.get_supports_target_humidity())
     resp.target_humidity = climate->target_humidity;
-  return this->send_climate_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_climate_info(climate::Climate *climate) {
   auto traits = climate->get_traits();
@@ -667,7 +680,7 @@ bool APIConnection::send_number_state(number::Number *number, float state) {
   resp.key = number->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !number->has_state();
-  return this->send_number_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_number_info(number::Number *number) {
   ListEntitiesNumberResponse msg;
@@ -711,7 +724,7 @@ bool APIConnection::send_date_state(datetime::DateEntity *date) {
   resp.year = date->year;
   resp.month = date->month;
   resp.day = date->day;
-  return this->send_date_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_date_info(datetime::DateEntity *date) {
   ListEntitiesDateResponse msg;
@@ -748,7 +761,7 @@ bool APIConnection::send_time_state(datetime::TimeEntity *time) {
   resp.hour = time->hour;
   resp.minute = time->minute;
   resp.second = time->second;
-  return this->send_time_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_time_info(datetime::TimeEntity *time) {
   ListEntitiesTimeResponse msg;
@@ -786,7 +799,7 @@ bool APIConnection::send_datetime_state(datetime::DateTimeEntity *datetime) {
     ESPTime state = datetime->state_as_esptime();
     resp.epoch_seconds = state.timestamp;
   }
-  return this->send_date_time_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_datetime_info(datetime::DateTimeEntity *datetime) {
   ListEntitiesDateTimeResponse msg;
@@ -821,7 +834,7 @@ bool APIConnection::send_text_state(text::Text *text, std::string state) {
   resp.key = text->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text->has_state();
-  return this->send_text_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_text_info(text::Text *text) {
   ListEntitiesTextResponse msg;
@@ -859,7 +872,7 @@ bool APIConnection::send_select_state(select::Select *select, std::string state)
   resp.key = select->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !select->has_state();
-  return this->send_select_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_select_info(select::Select *select) {
   ListEntitiesSelectResponse msg;
@@ -919,7 +932,7 @@ bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
   resp.state = static_cast<enums::LockState>(state);
-  return this->send_lock_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_lock_info(lock::Lock *a_lock) {
   ListEntitiesLockResponse msg;
@@ -964,7 +977,7 @@ bool APIConnection::send_valve_state(valve::Valve *valve) {
   resp.key = valve->get_object_id_hash();
   resp.position = valve->position;
   resp.current_operation = static_cast<enums::ValveOperation>(valve->current_operation);
-  return this->send_valve_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_valve_info(valve::Valve *valve) {
   auto traits = valve->get_traits();
@@ -1011,7 +1024,7 @@ bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_pla
   resp.state = static_cast<enums::MediaPlayerState>(report_state);
   resp.volume = media_player->volume;
   resp.muted = media_player->is_muted();
-  return this->send_media_player_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_media_player_info(media_player::MediaPlayer *media_player) {
   ListEntitiesMediaPlayerResponse msg;
@@ -1271,7 +1284,7 @@ bool APIConnection::send_alarm_control_panel_state(alarm_control_panel::AlarmCon
   AlarmControlPanelStateResponse resp{};
   resp.key = a_alarm_control_panel->get_object_id_hash();
   resp.state = static_cast<enums::AlarmControlPanelState>(a_alarm_control_panel->get_state());
-  return this->send_alarm_control_panel_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_alarm_control_panel_info(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
   ListEntitiesAlarmControlPanelResponse msg;
@@ -1366,7 +1379,7 @@ bool APIConnection::send_update_state(update::UpdateEntity *update) {
     resp.release_url = update->update_info.release_url;
   }
 
-  return this->send_update_state_response(resp);
+  return this->send_state_(resp);
 }
 bool APIConnection::send_update_info(update::UpdateEntity *update) {
   ListEntitiesUpdateResponse msg;
@@ -1403,20 +1416,134 @@ void APIConnection::update_command(const UpdateCommandRequest &msg) {
 }
 #endif
 
+#ifdef USE_COMPONENT_PROFILING
+static void fill_timing_stats(const TimingStats &stats, ComponentTimingStats &msg) {
+  msg.count = stats.count;
+  msg.total_us = stats.total_us;
+  msg.max_us = stats.max_us;
+  msg.histogram.assign(stats.histogram, stats.histogram + TimingStats::HISTOGRAM_BUCKETS);
+}
+void APIConnection::component_profile(const ComponentProfileRequest &msg) {
+  this->profile_at_ = 0;
+  this->profile_reset_ = msg.reset;
+  this->send_component_profiles_();
+}
+void APIConnection::send_component_profiles_() {
+  const auto &components = App.get_components();
+  while (this->profile_at_ < (int) components.size()) {
+    Component *component = components[this->profile_at_];
+    const ComponentProfile *profile = component->get_profile();
+    if (profile != nullptr) {
+      ComponentProfileResponse resp;
+      resp.source = component->get_component_source();
+      fill_timing_stats(profile->loop, resp.loop);
+      fill_timing_stats(profile->update, resp.update);
+      fill_timing_stats(profile->scheduler, resp.scheduler);
+      if (!this->send_component_profile_response(resp))
+        return;  // try again on the next loop
+    }
+    this->profile_at_++;
+  }
+
+  SchedulerProfileResponse resp;
+  fill_timing_stats(App.scheduler.get_lateness(), resp.lateness);
+  if (!this->send_scheduler_profile_response(resp))
+    return;
+  this->profile_at_ = -1;
+  if (this->profile_reset_) {
+    for (auto *component : components)
+      component->reset_profile();
+    App.scheduler.reset_lateness();
+  }
+}
+#endif
+
+void APIConnection::subscribe_logs(const SubscribeLogsRequest &msg) {
+  this->log_subscription_ = msg.level;
+#ifdef USE_LOGGER
+  this->compact_logs_ = msg.compact;
+  if (this->compact_logs_ && logger::global_logger != nullptr)
+    logger::global_logger->enable_message_source();
+#endif
+  if (msg.dump_config)
+    App.schedule_dump_config();
+}
+
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
   if (this->log_subscription_ < level)
     return false;
 
+#ifdef USE_LOGGER
+  if (this->compact_logs_) {
+    // Messages without a known source (like those from other tasks) are still sent as text
+    const auto *source = logger::global_logger->get_message_source();
+    if (source != nullptr) {
+      const uint16_t index = this->parent_->get_log_format_index(source->site, tag, source->line);
+      if (index != APIServer::LOG_FORMAT_NONE)
+        return this->send_compact_log_message_(level, tag, *source, index);
+    }
+  }
+#endif
+
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  const size_t line_len = strlen(line);
+  // level and message fields with their keys and the length of message
+  auto buffer = this->create_buffer(line_len + 8);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_len);
   // SubscribeLogsResponse - 29
   return this->send_buffer(buffer, 29);
 }
 
+#ifdef USE_LOGGER
+// Records in compact_message
+static const uint8_t LOG_RECORD_DEFINITION = 0x01;
+static const uint8_t LOG_RECORD_MESSAGE = 0x02;
+
+bool APIConnection::send_compact_log_message_(int level, const char *tag, const logger::Logger::MessageSource &source,
+                                              uint16_t index) {
+  // The host only learns what an index means from its definition, so that goes first the first time
+  const bool define = index >= this->log_formats_sent_.size() || !this->log_formats_sent_[index];
+  const size_t tag_len = strlen(tag);
+  const size_t format_len = strlen(source.format);
+  const auto line = static_cast<uint32_t>(source.line);
+  uint32_t payload_size = 1 + ProtoSize::varint(static_cast<uint32_t>(index)) + source.args_size;
+  if (define)
+    payload_size += 1 + ProtoSize::varint(static_cast<uint32_t>(index)) + ProtoSize::varint(line) + tag_len + 1 +
+                    format_len + 1;
+
+  auto buffer = this->create_buffer(payload_size + 16);
+  // LogLevel level = 1;
+  buffer.encode_uint32(1, static_cast<uint32_t>(level));
+  // bytes compact_message = 5;
+  buffer.encode_field_raw(5, 2);
+  buffer.encode_varint_raw(payload_size);
+  std::vector<uint8_t> &out = *buffer.get_buffer();
+  if (define) {
+    buffer.write(LOG_RECORD_DEFINITION);
+    buffer.encode_varint_raw(static_cast<uint32_t>(index));
+    buffer.encode_varint_raw(line);
+    out.insert(out.end(), tag, tag + tag_len + 1);
+    out.insert(out.end(), source.format, source.format + format_len + 1);
+  }
+  buffer.write(LOG_RECORD_MESSAGE);
+  buffer.encode_varint_raw(static_cast<uint32_t>(index));
+  out.insert(out.end(), source.args, source.args + source.args_size);
+  // SubscribeLogsResponse - 29
+  if (!this->send_buffer(buffer, 29))
+    return false;
+
+  if (define) {
+    if (index >= this->log_formats_sent_.size())
+      this->log_formats_sent_.resize(index + 1);
+    this->log_formats_sent_[index] = true;
+  }
+  return true;
+}
+#endif
+
 HelloResponse APIConnection::hello(const HelloRequest &msg) {
   this->client_info_ = msg.client_info;
   this->client_peername_ = this->helper_->getpeername();
@@ -1537,8 +1664,11 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
       return false;
     }
   }
+  // Queued states happened before this message, they have to go out first
+  if (!this->state_batch_.empty())
+    this->flush_state_batch_();
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  APIError err = this->helper_->write_protobuf_packet(message_type, buffer);
   if (err == APIError::WOULD_BLOCK)
     return false;
   if (err != APIError::OK) {
@@ -1554,6 +1684,115 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
   // Do not set last_traffic_ on send
   return true;
 }
+void APIConnection::make_room_in_state_batch_() {
+  if (this->state_batch_buffer_.size() >= MAX_STATE_BATCH_SIZE)
+    this->flush_state_batch_();
+}
+static uint32_t queued_state_hash(uint16_t message_type, uint32_t key) {
+  return key ^ (message_type * 2654435761UL);
+}
+APIConnection::QueuedState *APIConnection::find_queued_state_(uint16_t message_type, uint32_t key) {
+  if (this->state_batch_index_.empty())
+    return nullptr;
+  const uint32_t mask = this->state_batch_index_.size() - 1;
+  for (uint32_t i = queued_state_hash(message_type, key) & mask;; i = (i + 1) & mask) {
+    const uint16_t position = this->state_batch_index_[i];
+    if (position == 0)
+      return nullptr;
+    QueuedState &queued = this->state_batch_[position - 1];
+    if (queued.message_type == message_type && queued.key == key)
+      return &queued;
+  }
+}
+void APIConnection::index_queued_state_(uint16_t position) {
+  // Keep the table at most half full
+  if (this->state_batch_.size() * 2 > this->state_batch_index_.size()) {
+    this->state_batch_index_.assign(std::max<size_t>(this->state_batch_index_.size() * 2, MIN_STATE_BATCH_INDEX_SIZE),
+                                    0);
+    for (uint16_t other = 0; other < position; other++)
+      this->index_queued_state_(other);
+  }
+  const QueuedState &queued = this->state_batch_[position];
+  const uint32_t mask = this->state_batch_index_.size() - 1;
+  uint32_t i = queued_state_hash(queued.message_type, queued.key) & mask;
+  while (this->state_batch_index_[i] != 0)
+    i = (i + 1) & mask;
+  this->state_batch_index_[i] = position + 1;
+}
+bool APIConnection::queue_state_(uint16_t message_type, uint32_t key, uint32_t offset) {
+  const uint32_t size = this->state_batch_buffer_.size() - offset;
+  QueuedState *queued = this->find_queued_state_(message_type, key);
+  if (queued != nullptr) {
+    uint8_t *data = this->state_batch_buffer_.data();
+    if (queued->size == size) {
+      // Most states always encode to the same size, just overwrite the old one
+      std::memcpy(data + queued->offset, data + offset, size);
+      this->state_batch_buffer_.resize(offset);
+    } else if (offset < MAX_STATE_BATCH_SIZE) {
+      // Leave the old message as a gap, flushing skips it
+      queued->offset = offset;
+      queued->size = size;
+    } else {
+      // The batch is full and couldn't be sent, drop the old message so the buffer doesn't keep growing
+      this->state_batch_buffer_.erase(this->state_batch_buffer_.begin() + queued->offset,
+                                      this->state_batch_buffer_.begin() + queued->offset + queued->size);
+      for (auto &other : this->state_batch_) {
+        if (other.offset > queued->offset)
+          other.offset -= queued->size;
+      }
+      queued->offset = offset - queued->size;
+      queued->size = size;
+    }
+    return true;
+  }
+
+  if (offset >= MAX_STATE_BATCH_SIZE) {
+    this->state_batch_buffer_.resize(offset);
+    return false;
+  }
+  if (this->state_batch_.empty())
+    this->state_batch_start_ = millis();
+  this->state_batch_.push_back(QueuedState{message_type, key, offset, size});
+  this->index_queued_state_(this->state_batch_.size() - 1);
+  return true;
+}
+void APIConnection::flush_state_batch_() {
+  if (this->remove_)
+    return;
+  // Keep the updates queued (and replaced by newer ones) until the socket has room again
+  if (!this->helper_->can_write_without_blocking())
+    return;
+
+  const uint8_t header_padding = this->helper_->frame_header_padding();
+  const uint8_t footer_size = this->helper_->frame_footer_size();
+  const uint8_t *data = this->state_batch_buffer_.data();
+  this->proto_write_buffer_.clear();
+  this->proto_write_buffer_.reserve(this->state_batch_buffer_.size() +
+                                    this->state_batch_.size() * (header_padding + footer_size));
+  this->state_batch_packets_.clear();
+  for (auto &queued : this->state_batch_) {
+    const uint32_t frame_offset = this->proto_write_buffer_.size();
+    this->state_batch_packets_.push_back(PacketInfo{queued.message_type, frame_offset, queued.size});
+    this->proto_write_buffer_.resize(frame_offset + header_padding);
+    this->proto_write_buffer_.insert(this->proto_write_buffer_.end(), data + queued.offset,
+                                     data + queued.offset + queued.size);
+    this->proto_write_buffer_.resize(this->proto_write_buffer_.size() + footer_size);
+  }
+  ESP_LOGVV(TAG, "%s: Sending %u state updates", this->client_combined_info_.c_str(),
+            static_cast<unsigned>(this->state_batch_.size()));
+  this->state_batch_.clear();
+  std::fill(this->state_batch_index_.begin(), this->state_batch_index_.end(), 0);
+  this->state_batch_buffer_.clear();
+
+  APIError err = this->helper_->write_protobuf_packets(ProtoWriteBuffer{&this->proto_write_buffer_},
+                                                       this->state_batch_packets_.data(),
+                                                       this->state_batch_packets_.size());
+  if (err != APIError::OK && err != APIError::WOULD_BLOCK) {
+    on_fatal_error();
+    ESP_LOGW(TAG, "%s: Packet write failed %s errno=%d", this->client_combined_info_.c_str(), api_error_to_str(err),
+             errno);
+  }
+}
 void APIConnection::on_unauthenticated_access() {
   this->on_fatal_error();
   ESP_LOGD(TAG, "%s: tried to access without authentication.", this->client_combined_info_.c_str());
@@ -9,6 +9,10 @@
 #include "esphome/core/application.h"
 #include "esphome/core/component.h"
 
+#ifdef USE_LOGGER
+#include "esphome/components/logger/logger.h"
+#endif
+
 #include <vector>
 
 namespace esphome {
@@ -175,6 +179,10 @@ class APIConnection : public APIServerConnection {
   void update_command(const UpdateCommandRequest &msg) override;
 #endif
 
+#ifdef USE_COMPONENT_PROFILING
+  void component_profile(const ComponentProfileRequest &msg) override;
+#endif
+
   void on_disconnect_response(const DisconnectResponse &value) override;
   void on_ping_response(const PingResponse &value) override {
     // we initiated ping
@@ -195,11 +203,7 @@ class APIConnection : public APIServerConnection {
     this->state_subscription_ = true;
     this->initial_state_iterator_.begin();
   }
-  void subscribe_logs(const SubscribeLogsRequest &msg) override {
-    this->log_subscription_ = msg.level;
-    if (msg.dump_config)
-      App.schedule_dump_config();
-  }
+  void subscribe_logs(const SubscribeLogsRequest &msg) override;
   void subscribe_homeassistant_services(const SubscribeHomeassistantServicesRequest &msg) override {
     this->service_call_subscription_ = true;
   }
@@ -217,9 +221,13 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override {
     // FIXME: ensure no recursive writes can happen
+    const uint8_t header_padding = this->helper_->frame_header_padding();
     this->proto_write_buffer_.clear();
+    // Reserve room for the whole frame, so the frame helper can build it in place without reallocating
+    this->proto_write_buffer_.reserve(header_padding + reserve_size + this->helper_->frame_footer_size());
+    this->proto_write_buffer_.resize(header_padding);
     return {&this->proto_write_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
@@ -230,6 +238,41 @@ class APIConnection : public APIServerConnection {
   friend APIServer;
 
   bool send_(const void *buf, size_t len, bool force);
+#ifdef USE_LOGGER
+  /// Send a log message as the format index and packed arguments of \p source instead of its text.
+  bool send_compact_log_message_(int level, const char *tag, const logger::Logger::MessageSource &source,
+                                 uint16_t index);
+#endif
+
+  /** Queue a state update, to be sent together with the others in one write by flush_state_batch_().
+   *
+   * If the same entity still has a state queued, that one is replaced so only the latest state is sent. Returns false
+   * if the batch is full and the socket can't take it yet, the caller has to try again later.
+   */
+  template<class C> bool send_state_(const C &msg) {
+#ifdef HAS_PROTO_MESSAGE_DUMP
+    ESP_LOGVV("api.connection", "send_state: %s", msg.dump().c_str());
+#endif
+    if (this->remove_)
+      return false;
+    this->make_room_in_state_batch_();
+    const uint32_t offset = this->state_batch_buffer_.size();
+    msg.encode(ProtoWriteBuffer{&this->state_batch_buffer_});
+    return this->queue_state_(C::MESSAGE_TYPE, msg.key, offset);
+  }
+  /// Send the batch early if it's full.
+  void make_room_in_state_batch_();
+  /// Add the message encoded at \p offset in state_batch_buffer_ to the batch, replacing a queued one of the entity.
+  bool queue_state_(uint16_t message_type, uint32_t key, uint32_t offset);
+  struct QueuedState;
+  QueuedState *find_queued_state_(uint16_t message_type, uint32_t key);
+  void index_queued_state_(uint16_t position);
+  /// Send all queued state updates with a single write, if the socket can take them.
+  void flush_state_batch_();
+#ifdef USE_COMPONENT_PROFILING
+  /// Send the component profiles requested with component_profile(), as far as the TCP buffer allows.
+  void send_component_profiles_();
+#endif
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -242,6 +285,23 @@ class APIConnection : public APIServerConnection {
   // Buffer used to encode proto messages
   // Re-use to prevent allocations
   std::vector<uint8_t> proto_write_buffer_;
+
+  struct QueuedState {
+    uint16_t message_type;
+    uint32_t key;
+    /// Position of the encoded message in state_batch_buffer_
+    uint32_t offset;
+    uint32_t size;
+  };
+  /// State updates waiting to be sent, at most one per entity, in the order they were first queued
+  std::vector<QueuedState> state_batch_;
+  /// Open addressing hash table (power-of-two sized) of (message type, key) to position in state_batch_ + 1
+  std::vector<uint16_t> state_batch_index_;
+  /// The encoded messages of state_batch_. Replaced messages of a different size leave a gap until the next flush.
+  std::vector<uint8_t> state_batch_buffer_;
+  std::vector<PacketInfo> state_batch_packets_;
+  /// When the oldest update in state_batch_ was queued
+  uint32_t state_batch_start_{0};
   std::unique_ptr<APIFrameHelper> helper_;
 
   std::string client_info_;
@@ -255,6 +315,11 @@ class APIConnection : public APIServerConnection {
 
   bool state_subscription_{false};
   int log_subscription_{ESPHOME_LOG_LEVEL_NONE};
+#ifdef USE_LOGGER
+  bool compact_logs_{false};
+  /// Which log format indices were already defined on this connection
+  std::vector<bool> log_formats_sent_;
+#endif
   uint32_t last_traffic_;
   uint32_t next_ping_retry_{0};
   uint8_t ping_retries_{0};
@@ -265,6 +330,11 @@ class APIConnection : public APIServerConnection {
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
   int state_subs_at_ = -1;
+#ifdef USE_COMPONENT_PROFILING
+  /// Index of the next component to send the profile of, -1 if no profiles were requested.
+  int profile_at_ = -1;
+  bool profile_reset_{false};
+#endif
 };
 
 }  // namespace api
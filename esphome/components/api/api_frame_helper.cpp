@@ -72,6 +72,14 @@ const char *api_error_to_str(APIError err) {
   return "UNKNOWN";
 }
 
+APIError APIFrameHelper::write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) {
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  PacketInfo packet{type, 0, static_cast<uint32_t>(raw_buffer->size() - this->frame_header_padding())};
+  // Room for the footer, this doesn't reallocate when the buffer was created with create_buffer()
+  raw_buffer->resize(raw_buffer->size() + this->frame_footer_size());
+  return this->write_protobuf_packets(buffer, &packet, 1);
+}
+
 #define HELPER_LOG(msg, ...) ESP_LOGVV(TAG, "%s: " msg, info_.c_str(), ##__VA_ARGS__)
 // uncomment to log raw packets
 //#define HELPER_LOG_PACKETS
@@ -467,7 +475,8 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   return APIError::OK;
 }
 bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets,
+                                                     size_t count) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -478,45 +487,42 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
   if (state_ != State::DATA) {
     return APIError::WOULD_BLOCK;
   }
+  if (count == 0)
+    return APIError::OK;
 
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
-  }
-
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
   const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  size_t total_len = 0;
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    const size_t msg_len = 4 + packet.payload_size;
+    uint8_t *buf = raw_buffer->data() + packet.offset;
+
+    buf[0] = 0x01;  // indicator
+    // buf[1], buf[2] to be set later
+    buf[msg_offset + 0] = (uint8_t) (packet.message_type >> 8);  // type
+    buf[msg_offset + 1] = (uint8_t) packet.message_type;
+    buf[msg_offset + 2] = (uint8_t) (packet.payload_size >> 8);  // data_len
+    buf[msg_offset + 3] = (uint8_t) packet.payload_size;
+
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, &buf[msg_offset], msg_len, msg_len + frame_footer_size_);
+    err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+    if (err != 0) {
+      state_ = State::FAILED;
+      HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
+      return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    }
 
-  NoiseBuffer mbuf;
-  noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
-  err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
-  if (err != 0) {
-    state_ = State::FAILED;
-    HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
-    return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    buf[1] = (uint8_t) (mbuf.size >> 8);
+    buf[2] = (uint8_t) mbuf.size;
+    total_len += msg_offset + mbuf.size;
   }
 
-  size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
-
+  // The encrypted frames exactly fill their slots, so they can go out as one block
   struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
+  iov.iov_base = raw_buffer->data() + packets[0].offset;
   iov.iov_len = total_len;
 
   // write raw to not have two packets sent if NAGLE disabled
@@ -693,6 +699,8 @@ APIError APINoiseFrameHelper::check_handshake_finished_() {
     return APIError::HANDSHAKESTATE_SPLIT_FAILED;
   }
 
+  frame_footer_size_ = noise_cipherstate_get_mac_length(send_cipher_);
+
   HELPER_LOG("Handshake complete!");
   noise_handshakestate_free(handshake_);
   handshake_ = nullptr;
@@ -903,26 +911,42 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   return APIError::OK;
 }
 bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets,
+                                                         size_t count) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
+  if (count == 0)
+    return APIError::OK;
+
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
+  const uint8_t padding = frame_header_padding();
+  // The headers vary in size and leave gaps between the frames, so every frame gets its own iovec
+  struct iovec single_iov;
+  std::vector<struct iovec> iovs;
+  struct iovec *iov = &single_iov;
+  if (count > 1) {
+    iovs.resize(count);
+    iov = iovs.data();
+  }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
+  for (size_t i = 0; i < count; i++) {
+    const PacketInfo &packet = packets[i];
+    const uint32_t size_varint_len = ProtoSize::varint(packet.payload_size);
+    const uint32_t type_varint_len = ProtoSize::varint(static_cast<uint32_t>(packet.message_type));
+    const uint32_t header_len = 1 + size_varint_len + type_varint_len;
 
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  if (payload_len == 0) {
-    return write_raw_(iov, 1);
+    // write the header right in front of the payload
+    uint8_t *header = raw_buffer->data() + packet.offset + padding - header_len;
+    header[0] = 0x00;  // indicator
+    ProtoVarInt(packet.payload_size).encode_to_buffer_unchecked(header + 1, size_varint_len);
+    ProtoVarInt(packet.message_type).encode_to_buffer_unchecked(header + 1 + size_varint_len, type_varint_len);
+
+    iov[i].iov_base = header;
+    iov[i].iov_len = header_len + packet.payload_size;
   }
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
 
-  return write_raw_(iov, 2);
+  return write_raw_(iov, count);
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
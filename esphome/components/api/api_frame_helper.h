@@ -12,6 +12,7 @@
 
 #include "api_noise_context.h"
 #include "esphome/components/socket/socket.h"
+#include "proto.h"
 
 namespace esphome {
 namespace api {
@@ -58,14 +59,40 @@ enum class APIError : int {
 
 const char *api_error_to_str(APIError err);
 
+/// Position of a message in a buffer holding several frames, see APIFrameHelper::write_protobuf_packets().
+struct PacketInfo {
+  uint16_t message_type;
+  /// Start of the frame, where the frame_header_padding() bytes in front of the message begin.
+  uint32_t offset;
+  uint32_t payload_size;
+};
+
 class APIFrameHelper {
  public:
   virtual ~APIFrameHelper() = default;
   virtual APIError init() = 0;
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
+  /// Whether there may be data to read, see socket::Socket::ready().
+  virtual bool can_read() const = 0;
   virtual bool can_write_without_blocking() = 0;
-  virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  /** Send a message that was encoded into a buffer from APIConnection::create_buffer().
+   *
+   * The buffer starts with frame_header_padding() bytes of space for the frame header, followed by the encoded
+   * message. The frame is built in place (the buffer is extended by frame_footer_size() bytes if needed), so that
+   * header, payload and footer can be passed to the socket with a single write.
+   */
+  APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer);
+  /** Send several messages from one buffer with a single write.
+   *
+   * Each frame takes frame_header_padding() + payload_size + frame_footer_size() bytes starting at its offset, and
+   * the frames follow each other without gaps, in the order they're passed in.
+   */
+  virtual APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) = 0;
+  /// Number of bytes to leave in front of the message for the frame header.
+  virtual uint8_t frame_header_padding() = 0;
+  /// Number of bytes the frame needs after the message, for example for the MAC of encrypted frames.
+  virtual uint8_t frame_footer_size() = 0;
   virtual std::string getpeername() = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual APIError close() = 0;
@@ -83,8 +110,12 @@ class APINoiseFrameHelper : public APIFrameHelper {
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
+  bool can_read() const override { return this->socket_->ready(); }
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) override;
+  // indicator byte, 16-bit frame size, then the encrypted 16-bit type and 16-bit payload size
+  uint8_t frame_header_padding() override { return 7; }
+  uint8_t frame_footer_size() override { return this->frame_footer_size_; }
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -118,6 +149,8 @@ class APINoiseFrameHelper : public APIFrameHelper {
 
   std::vector<uint8_t> tx_buf_;
   std::vector<uint8_t> prologue_;
+  /// Size of the MAC appended to encrypted frames, only known once the handshake is done.
+  uint8_t frame_footer_size_ = 0;
 
   std::shared_ptr<APINoiseContext> ctx_;
   NoiseHandshakeState *handshake_{nullptr};
@@ -146,8 +179,12 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
+  bool can_read() const override { return this->socket_->ready(); }
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const PacketInfo *packets, size_t count) override;
+  // indicator byte, then payload size and type as varints (up to 5 and 3 bytes)
+  uint8_t frame_header_padding() override { return 9; }
+  uint8_t frame_footer_size() override { return 0; }
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -652,6 +652,18 @@ bool APIServerConnectionBase::send_update_state_response(const UpdateStateRespon
 #endif
 #ifdef USE_UPDATE
 #endif
+#ifdef USE_COMPONENT_PROFILING
+#endif
+#ifdef USE_COMPONENT_PROFILING
+bool APIServerConnectionBase::send_component_profile_response(const ComponentProfileResponse &msg) {
+  return this->send_message_<ComponentProfileResponse>(msg, 125);
+}
+#endif
+#ifdef USE_COMPONENT_PROFILING
+bool APIServerConnectionBase::send_scheduler_profile_response(const SchedulerProfileResponse &msg) {
+  return this->send_message_<SchedulerProfileResponse>(msg, 126);
+}
+#endif
 bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) {
   switch (msg_type) {
     case 1: {
@@ -1191,6 +1203,17 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       ESP_LOGVV(TAG, "on_voice_assistant_set_configuration: %s", msg.dump().c_str());
 #endif
       this->on_voice_assistant_set_configuration(msg);
+#endif
+      break;
+    }
+    case 124: {
+#ifdef USE_COMPONENT_PROFILING
+      ComponentProfileRequest msg;
+      msg.decode(msg_data, msg_size);
+#ifdef HAS_PROTO_MESSAGE_DUMP
+      ESP_LOGVV(TAG, "on_component_profile_request: %s", msg.dump().c_str());
+#endif
+      this->on_component_profile_request(msg);
 #endif
       break;
     }
@@ -1723,6 +1746,19 @@ void APIServerConnection::on_alarm_control_panel_command_request(const AlarmCont
   this->alarm_control_panel_command(msg);
 }
 #endif
+#ifdef USE_COMPONENT_PROFILING
+void APIServerConnection::on_component_profile_request(const ComponentProfileRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  this->component_profile(msg);
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
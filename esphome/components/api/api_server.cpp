@@ -15,6 +15,7 @@
 #endif
 
 #include <algorithm>
+#include <functional>
 
 namespace esphome {
 namespace api {
@@ -25,7 +26,7 @@ static const char *const TAG = "api";
 void APIServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Home Assistant API server...");
   this->setup_controller();
-  socket_ = socket::socket_ip(SOCK_STREAM, 0);
+  socket_ = socket::socket_ip_loop_monitored(SOCK_STREAM, 0);
   if (socket_ == nullptr) {
     ESP_LOGW(TAG, "Could not create socket.");
     this->mark_failed();
@@ -94,7 +95,7 @@ void APIServer::setup() {
 }
 void APIServer::loop() {
   // Accept new clients
-  while (true) {
+  while (this->socket_->ready()) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     auto sock = socket_->accept((struct sockaddr *) &source_addr, &addr_len);
@@ -139,6 +140,7 @@ void APIServer::loop() {
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Batch delay: %ums", this->batch_delay_);
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Using noise encryption: YES");
 #else
@@ -386,6 +388,32 @@ void APIServer::request_time() {
 }
 #endif
 bool APIServer::is_connected() const { return !this->clients_.empty(); }
+
+#ifdef USE_LOGGER
+/// Messages from call sites beyond this are sent as text.
+static const size_t MAX_LOG_FORMATS = 512;
+
+uint16_t APIServer::get_log_format_index(const void *site, const char *tag, int line) {
+  // The format strings of call sites are literals, so their addresses identify them without looking at the text.
+  // Identical literals may be merged by the linker, the tag and line tell those apart.
+  const LogFormat key{site, tag, static_cast<uint16_t>(line), 0};
+  auto it = std::lower_bound(this->log_formats_.begin(), this->log_formats_.end(), key,
+                             [](const LogFormat &a, const LogFormat &b) {
+                               if (a.site != b.site)
+                                 return std::less<const void *>()(a.site, b.site);
+                               if (a.tag != b.tag)
+                                 return std::less<const char *>()(a.tag, b.tag);
+                               return a.line < b.line;
+                             });
+  if (it != this->log_formats_.end() && it->site == site && it->tag == tag && it->line == key.line)
+    return it->index;
+  if (this->log_formats_.size() >= MAX_LOG_FORMATS)
+    return LOG_FORMAT_NONE;
+  const auto index = static_cast<uint16_t>(this->log_formats_.size());
+  this->log_formats_.insert(it, LogFormat{site, tag, key.line, index});
+  return index;
+}
+#endif
 void APIServer::on_shutdown() {
   for (auto &c : this->clients_) {
     c->send_disconnect_request(DisconnectRequest());
@@ -33,6 +33,9 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  /// How long state updates may be held back to be sent together, 0 sends them once per loop iteration.
+  void set_batch_delay(uint16_t batch_delay) { this->batch_delay_ = batch_delay; }
+  uint16_t get_batch_delay() const { return this->batch_delay_; }
 
 #ifdef USE_API_NOISE
   void set_noise_psk(psk_t psk) { noise_ctx_->set_psk(psk); }
@@ -109,6 +112,17 @@ class APIServer : public Component, public Controller {
 
   bool is_connected() const;
 
+#ifdef USE_LOGGER
+  static const uint16_t LOG_FORMAT_NONE = 0xFFFF;
+  /** Index of a log call site for compact log subscriptions, LOG_FORMAT_NONE if the dictionary is full.
+   *
+   * Call sites are told apart by the addresses of their tag and format string (\p site) and their line, nothing is
+   * hashed. Indices are shared by all connections and stay the same for as long as the device runs, each connection
+   * sends the definition of an index before its first use.
+   */
+  uint16_t get_log_format_index(const void *site, const char *tag, int line);
+#endif
+
   struct HomeAssistantStateSubscription {
     std::string entity_id;
     optional<std::string> attribute;
@@ -132,6 +146,7 @@ class APIServer : public Component, public Controller {
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
+  uint16_t batch_delay_{0};
   uint32_t last_connected_{0};
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
@@ -139,6 +154,17 @@ class APIServer : public Component, public Controller {
   std::vector<UserServiceDescriptor *> user_services_;
   Trigger<std::string, std::string> *client_connected_trigger_ = new Trigger<std::string, std::string>();
   Trigger<std::string, std::string> *client_disconnected_trigger_ = new Trigger<std::string, std::string>();
+#ifdef USE_LOGGER
+  struct LogFormat {
+    /// Call site, see logger::Logger::MessageSource::site.
+    const void *site;
+    const char *tag;
+    uint16_t line;
+    uint16_t index;
+  };
+  /// Sorted by call site, tag and line; the index is the order they were added in.
+  std::vector<LogFormat> log_formats_;
+#endif
 
 #ifdef USE_API_NOISE
   std::shared_ptr<APINoiseContext> noise_ctx_ = std::make_shared<APINoiseContext>();
@@ -1,22 +1,47 @@
 from __future__ import annotations
 
 import asyncio
-import logging
 from datetime import datetime
-from typing import Any
+import logging
+from typing import Any, Callable
 
-from aioesphomeapi import APIClient
-from aioesphomeapi.api_pb2 import SubscribeLogsResponse
+from aioesphomeapi import APIClient, LogLevel
+from aioesphomeapi.api_pb2 import SubscribeLogsRequest, SubscribeLogsResponse
 from aioesphomeapi.log_runner import async_run
 
 from esphome.const import CONF_KEY, CONF_PASSWORD, CONF_PORT, __version__
 from esphome.core import CORE
 
 from . import CONF_ENCRYPTION
+from .log_decoder import LogDecoder
 
 _LOGGER = logging.getLogger(__name__)
 
 
+class CompactLogsAPIClient(APIClient):
+    """API client that asks for compact log messages when its protobuf messages know them."""
+
+    def subscribe_logs(
+        self,
+        on_log: Callable[[SubscribeLogsResponse], None],
+        log_level: LogLevel | None = None,
+        dump_config: bool | None = None,
+    ) -> None:
+        # aioesphomeapi generated from an api.proto without the compact field only gets text
+        if "compact" not in SubscribeLogsRequest.DESCRIPTOR.fields_by_name:
+            super().subscribe_logs(on_log, log_level=log_level, dump_config=dump_config)
+            return
+        req = SubscribeLogsRequest(compact=True)
+        if log_level is not None:
+            req.level = log_level
+        if dump_config is not None:
+            req.dump_config = dump_config
+        # Firmware without compact logs ignores the field and keeps sending text
+        self._get_connection().send_message_callback_response(
+            req, on_log, (SubscribeLogsResponse,)
+        )
+
+
 async def async_run_logs(config: dict[str, Any], address: str) -> None:
     """Run the logs command in the event loop."""
     conf = config["api"]
@@ -27,7 +52,7 @@ async def async_run_logs(config: dict[str, Any], address: str) -> None:
     if CONF_ENCRYPTION in conf:
         noise_psk = conf[CONF_ENCRYPTION][CONF_KEY]
     _LOGGER.info("Starting log output from %s using esphome API", address)
-    cli = APIClient(
+    cli = CompactLogsAPIClient(
         address,
         port,
         password,
@@ -35,11 +60,20 @@ async def async_run_logs(config: dict[str, Any], address: str) -> None:
         noise_psk=noise_psk,
     )
     dashboard = CORE.dashboard
+    decoder = LogDecoder()
 
     def on_log(msg: SubscribeLogsResponse) -> None:
         """Handle a new log message."""
         time_ = datetime.now()
         message: bytes = msg.message
+        if not message:
+            data: bytes = getattr(msg, "compact_message", b"")
+            if not data:
+                return
+            if (text := decoder.decode(msg.level, data)) is None:
+                _LOGGER.debug("Can't decode compact log message %s", data.hex())
+                return
+            message = text.encode()
         text = message.decode("utf8", "backslashreplace")
         if dashboard:
             text = text.replace("\033", "\\033")
@@ -0,0 +1,193 @@
+"""Rebuild log lines from the compact log messages of the native API.
+
+Clients that subscribe with ``compact`` set get messages as a format string index
+and the packed arguments instead of the text. The definition of an index (tag,
+line and format string) is sent on the connection right before its first use.
+See ``APIConnection::send_compact_log_message_`` and ``pack_log_args`` for the
+firmware side.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+import re
+import struct
+
+LOG_RECORD_DEFINITION = 0x01
+LOG_RECORD_MESSAGE = 0x02
+
+# Same as LOG_LEVEL_COLORS and LOG_LEVEL_LETTERS in logger.cpp
+LOG_LEVEL_COLORS = (
+    "",
+    "\033[1;31m",
+    "\033[0;33m",
+    "\033[0;32m",
+    "\033[0;35m",
+    "\033[0;36m",
+    "\033[0;37m",
+    "\033[0;38m",
+)
+LOG_LEVEL_LETTERS = ("", "E", "W", "I", "C", "D", "V", "VV")
+LOG_RESET_COLOR = "\033[0m"
+
+# A printf conversion: flags, width, precision, length and conversion character
+CONVERSION_RE = re.compile(
+    rb"%(?P<flags>[-+ #0]*)(?P<width>\*|\d*)(?:\.(?P<precision>\*|\d*))?"
+    rb"(?P<length>hh|h|ll|l|z|j|t|L)?(?P<type>.?)",
+    re.DOTALL,
+)
+SIGNED_TYPES = b"di"
+UNSIGNED_TYPES = b"uoxX"
+FLOAT_TYPES = b"fFeEgGaA"
+KNOWN_TYPES = SIGNED_TYPES + UNSIGNED_TYPES + FLOAT_TYPES + b"cspn"
+
+DOUBLE = struct.Struct("<d")
+
+
+@dataclass(frozen=True)
+class LogFormat:
+    tag: str
+    line: int
+    format: bytes
+
+
+def _decode(data: bytes) -> str:
+    return data.decode("utf8", "backslashreplace")
+
+
+def _read_varint(data: bytes, pos: int) -> tuple[int, int]:
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return value, pos
+        shift += 7
+
+
+def _read_signed(data: bytes, pos: int) -> tuple[int, int]:
+    """Read a zigzag encoded varint."""
+    value, pos = _read_varint(data, pos)
+    return (value >> 1) ^ -(value & 1), pos
+
+
+def _read_cstring(data: bytes, pos: int) -> tuple[bytes, int]:
+    end = data.index(b"\0", pos)
+    return data[pos:end], end + 1
+
+
+def _truncate(value: int, length: bytes | None, signed: bool) -> int:
+    """Apply the hh and h length modifiers like printf does."""
+    if length == b"hh":
+        bits = 8
+    elif length == b"h":
+        bits = 16
+    else:
+        return value
+    value &= (1 << bits) - 1
+    if signed and value >= 1 << (bits - 1):
+        value -= 1 << bits
+    return value
+
+
+def format_args(fmt: bytes, args: bytes) -> str:
+    """Print a format string with arguments packed by ``pack_log_args``."""
+    out: list[str] = []
+    pos = 0
+    literal_start = 0
+    for match in CONVERSION_RE.finditer(fmt):
+        out.append(_decode(fmt[literal_start : match.start()]))
+        literal_start = match.end()
+        conv = match["type"]
+        if conv == b"%":
+            out.append("%")
+            continue
+        if not conv or conv not in KNOWN_TYPES:
+            # The firmware stops packing at conversions it doesn't know
+            literal_start = match.start()
+            break
+
+        spec = b"%" + match["flags"]
+        for part, prefix in ((match["width"], b""), (match["precision"], b".")):
+            if part is None:
+                continue
+            if part == b"*":
+                star, pos = _read_signed(args, pos)
+                if prefix and star < 0:
+                    # A negative precision counts as if there was none
+                    continue
+                if not prefix and star < 0:
+                    spec += b"-"
+                    star = -star
+                part = str(star).encode()
+            spec += prefix + part
+
+        value: object
+        if conv in SIGNED_TYPES:
+            value, pos = _read_signed(args, pos)
+            value = _truncate(value, match["length"], True)
+            conv = b"d"
+        elif conv in UNSIGNED_TYPES:
+            value, pos = _read_varint(args, pos)
+            value = _truncate(value, match["length"], False)
+            conv = b"d" if conv == b"u" else conv
+        elif conv in FLOAT_TYPES:
+            (value,) = DOUBLE.unpack_from(args, pos)
+            pos += DOUBLE.size
+            if conv in b"aA":
+                value = value.hex()
+                conv = b"s"
+        elif conv == b"c":
+            value, pos = _read_signed(args, pos)
+            value &= 0xFF
+        elif conv == b"s":
+            raw, pos = _read_cstring(args, pos)
+            value = _decode(raw)
+        elif conv == b"p":
+            value, pos = _read_varint(args, pos)
+            value = f"0x{value:x}"
+            conv = b"s"
+        else:
+            # %n prints nothing
+            continue
+        out.append((spec + conv).decode() % value)
+    out.append(_decode(fmt[literal_start:]))
+    return "".join(out)
+
+
+class LogDecoder:
+    """Decode the compact log messages of one API connection."""
+
+    def __init__(self) -> None:
+        self._formats: dict[int, LogFormat] = {}
+
+    def decode(self, level: int, data: bytes) -> str | None:
+        """Return the log line like the firmware prints it.
+
+        Returns None if the message uses an index that was never defined.
+        """
+        pos = 0
+        while pos < len(data):
+            record = data[pos]
+            index, pos = _read_varint(data, pos + 1)
+            if record == LOG_RECORD_DEFINITION:
+                line, pos = _read_varint(data, pos)
+                tag, pos = _read_cstring(data, pos)
+                fmt, pos = _read_cstring(data, pos)
+                self._formats[index] = LogFormat(_decode(tag), line, fmt)
+            elif record == LOG_RECORD_MESSAGE:
+                if (log_format := self._formats.get(index)) is None:
+                    return None
+                level = min(max(level, 0), 7)
+                color = LOG_LEVEL_COLORS[level]
+                header = (
+                    f"{color}[{LOG_LEVEL_LETTERS[level]}]"
+                    f"[{log_format.tag}:{log_format.line:03}]: "
+                )
+                text = format_args(log_format.format, data[pos:])
+                return f"{header}{text}{LOG_RESET_COLOR}"
+            else:
+                return None
+        return None
@@ -253,6 +253,9 @@ void BekenSPILEDStripLightOutput::write_state(light::LightState *state) {
     this->schedule_show();
     return;
   }
+  int32_t from, to;
+  if (!this->take_dirty_range_(from, to))
+    return;
   this->last_refresh_ = now;
   this->mark_shown_();
 
@@ -266,25 +269,30 @@ void BekenSPILEDStripLightOutput::write_state(light::LightState *state) {
 
   if (!spi_data->first_run && !xSemaphoreTake(spi_data->dma_tx_semaphore, 10 / portTICK_PERIOD_MS)) {
     ESP_LOGE(TAG, "Timed out waiting for semaphore");
+    // these LEDs haven't been encoded yet
+    this->mark_dirty(from, to);
     return;
   }
 
   if (spi_data->tx_in_progress) {
     ESP_LOGE(TAG, "tx_in_progress is set");
     this->status_set_warning();
+    this->mark_dirty(from, to);
     return;
   }
 
   spi_data->tx_in_progress = true;
 
-  size_t buffer_size = this->get_buffer_size_();
-  size_t size = 0;
-  uint8_t *psrc = this->buf_;
-  uint8_t *pdest = this->dma_buf_ + 64;
+  // The bits of the LEDs that didn't change are still in the DMA buffer from the last frame, only encode the others
+  const size_t bytes_per_led = this->get_buffer_size_() / this->num_leds_;
+  const size_t end = to * bytes_per_led;
+  size_t size = from * bytes_per_led;
+  uint8_t *psrc = this->buf_ + size;
+  uint8_t *pdest = this->dma_buf_ + 64 + size * 8;
   // The 64 byte padding is a workaround for a SPI DMA bug where the
   // output doesn't exactly start at the beginning of dma_buf_
 
-  while (size < buffer_size) {
+  while (size < end) {
     uint8_t b = *psrc;
     for (int i = 0; i < 8; i++) {
       *pdest++ = b & (1 << (7 - i)) ? this->bit1_ : this->bit0_;
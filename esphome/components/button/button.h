@@ -38,7 +38,7 @@ class Button : public EntityBase, public EntityBase_DeviceClass {
    *
    * @param callback The void() callback.
    */
-  void add_on_press_callback(std::function<void()> &&callback);
+  void add_on_press_callback(InlineFunction<void()> &&callback);
 
  protected:
   /** You should implement this virtual method if you want to create your own button.
@@ -315,11 +315,11 @@ ClimateCall &ClimateCall::set_swing_mode(optional<ClimateSwingMode> swing_mode)
   return *this;
 }
 
-void Climate::add_on_state_callback(std::function<void(Climate &)> &&callback) {
+void Climate::add_on_state_callback(InlineFunction<void(Climate &)> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 
-void Climate::add_on_control_callback(std::function<void(ClimateCall &)> &&callback) {
+void Climate::add_on_control_callback(InlineFunction<void(ClimateCall &)> &&callback) {
   this->control_callback_.add(std::move(callback));
 }
 
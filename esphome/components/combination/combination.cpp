@@ -63,8 +63,9 @@ void KalmanCombinationComponent::dump_config() {
 
 void KalmanCombinationComponent::setup() {
   for (const auto &sensor : this->sensor_pairs_) {
-    const auto stddev = sensor.second;
-    sensor.first->add_on_state_callback([this, stddev](float x) -> void { this->correct_(x, stddev(x)); });
+    // sensor_pairs_ doesn't change after setup, so the callback can refer to the function in there
+    const auto *stddev = &sensor.second;
+    sensor.first->add_on_state_callback([this, stddev](float x) -> void { this->correct_(x, (*stddev)(x)); });
   }
 }
 
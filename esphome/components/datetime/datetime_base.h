@@ -18,7 +18,7 @@ class DateTimeBase : public EntityBase {
 
   virtual ESPTime state_as_esptime() const = 0;
 
-  void add_on_state_callback(std::function<void()> &&callback) { this->state_callback_.add(std::move(callback)); }
+  void add_on_state_callback(InlineFunction<void()> &&callback) { this->state_callback_.add(std::move(callback)); }
 
 #ifdef USE_TIME
   void set_rtc(time::RealTimeClock *rtc) { this->rtc_ = rtc; }
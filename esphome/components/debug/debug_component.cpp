@@ -1,6 +1,7 @@
 #include "debug_component.h"
 
 #include <algorithm>
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
@@ -29,6 +30,9 @@ void DebugComponent::dump_config() {
   LOG_SENSOR("  ", "Heap fragmentation", this->fragmentation_sensor_);
 #endif  // defined(USE_ESP8266) && USE_ARDUINO_VERSION_CODE >= VERSION_CODE(2, 5, 2)
 #endif  // USE_SENSOR
+#ifdef USE_COMPONENT_PROFILING
+  ESP_LOGCONFIG(TAG, "  Component profiling: enabled");
+#endif
 
   std::string device_info;
   device_info.reserve(256);
@@ -85,8 +89,46 @@ void DebugComponent::update() {
 
 #endif  // USE_SENSOR
   update_platform_();
+#ifdef USE_COMPONENT_PROFILING
+  this->log_profiles_();
+#endif
+}
+
+#ifdef USE_COMPONENT_PROFILING
+static uint64_t total_time(const ComponentProfile *profile) {
+  return profile->loop.total_us + profile->update.total_us + profile->scheduler.total_us;
+}
+static void log_timing_stats(const char *source, const char *activity, const TimingStats &stats) {
+  if (stats.count == 0)
+    return;
+  ESP_LOGD(TAG, "  %s %s: %" PRIu32 " calls, avg %" PRIu32 " us, p90 < %" PRIu32 " us, max %" PRIu32 " us", source,
+           activity, stats.count, static_cast<uint32_t>(stats.total_us / stats.count), stats.percentile_upper_bound(90),
+           stats.max_us);
 }
 
+void DebugComponent::log_profiles_() {
+  std::vector<Component *> components;
+  for (auto *component : App.get_components()) {
+    if (component->get_profile() != nullptr)
+      components.push_back(component);
+  }
+  // Most expensive first
+  std::sort(components.begin(), components.end(), [](const Component *a, const Component *b) {
+    return total_time(a->get_profile()) > total_time(b->get_profile());
+  });
+
+  ESP_LOGD(TAG, "Component timings:");
+  for (auto *component : components) {
+    const ComponentProfile *profile = component->get_profile();
+    const char *source = component->get_component_source();
+    log_timing_stats(source, "loop", profile->loop);
+    log_timing_stats(source, "update", profile->update);
+    log_timing_stats(source, "scheduler", profile->scheduler);
+  }
+  log_timing_stats("scheduler", "lateness", App.scheduler.get_lateness());
+}
+#endif
+
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
 }  // namespace debug
@@ -64,6 +64,9 @@ class DebugComponent : public PollingComponent {
   uint32_t get_free_heap_();
   void get_device_info_(std::string &device_info);
   void update_platform_();
+#ifdef USE_COMPONENT_PROFILING
+  void log_profiles_();
+#endif
 };
 
 }  // namespace debug
@@ -12,6 +12,17 @@ static const char *const TAG = "display";
 const Color COLOR_OFF(0, 0, 0, 0);
 const Color COLOR_ON(255, 255, 255, 255);
 
+/// Pixels converted at a time before they're drawn as a span.
+static const int SPAN_CHUNK_PIXELS = 32;
+
+static inline uint8_t blend_channel(uint8_t fg, uint8_t bg, uint8_t alpha) {
+  return bg + ((int(fg) - int(bg)) * alpha + (fg > bg ? 127 : -127)) / 255;
+}
+static inline Color blend_color(Color color, Color background, uint8_t alpha) {
+  return Color(blend_channel(color.r, background.r, alpha), blend_channel(color.g, background.g, alpha),
+               blend_channel(color.b, background.b, alpha), blend_channel(color.w, background.w, alpha));
+}
+
 void Display::fill(Color color) { this->filled_rectangle(0, 0, this->get_width(), this->get_height(), color); }
 void Display::clear() { this->fill(COLOR_OFF); }
 void Display::set_rotation(DisplayRotation rotation) { this->rotation_ = rotation; }
@@ -55,41 +66,86 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
                              ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) {
   size_t line_stride = x_offset + w + x_pad;  // length of each source line in pixels
   uint32_t color_value;
+  Color colors[SPAN_CHUNK_PIXELS];
   for (int y = 0; y != h; y++) {
     size_t source_idx = (y_offset + y) * line_stride + x_offset;
     size_t source_idx_mod;
-    for (int x = 0; x != w; x++, source_idx++) {
-      switch (bitness) {
-        default:
-          color_value = ptr[source_idx];
-          break;
-        case COLOR_BITNESS_565:
-          source_idx_mod = source_idx * 2;
-          if (big_endian) {
-            color_value = (ptr[source_idx_mod] << 8) + ptr[source_idx_mod + 1];
-          } else {
-            color_value = ptr[source_idx_mod] + (ptr[source_idx_mod + 1] << 8);
-          }
-          break;
-        case COLOR_BITNESS_888:
-          source_idx_mod = source_idx * 3;
-          if (big_endian) {
-            color_value = (ptr[source_idx_mod + 0] << 16) + (ptr[source_idx_mod + 1] << 8) + ptr[source_idx_mod + 2];
-          } else {
-            color_value = ptr[source_idx_mod + 0] + (ptr[source_idx_mod + 1] << 8) + (ptr[source_idx_mod + 2] << 16);
-          }
-          break;
+    for (int x = 0; x != w; x += SPAN_CHUNK_PIXELS) {
+      const int count = std::min(w - x, SPAN_CHUNK_PIXELS);
+      for (int i = 0; i != count; i++, source_idx++) {
+        switch (bitness) {
+          default:
+            color_value = ptr[source_idx];
+            break;
+          case COLOR_BITNESS_565:
+            source_idx_mod = source_idx * 2;
+            if (big_endian) {
+              color_value = (ptr[source_idx_mod] << 8) + ptr[source_idx_mod + 1];
+            } else {
+              color_value = ptr[source_idx_mod] + (ptr[source_idx_mod + 1] << 8);
+            }
+            break;
+          case COLOR_BITNESS_888:
+            source_idx_mod = source_idx * 3;
+            if (big_endian) {
+              color_value = (ptr[source_idx_mod + 0] << 16) + (ptr[source_idx_mod + 1] << 8) + ptr[source_idx_mod + 2];
+            } else {
+              color_value = ptr[source_idx_mod + 0] + (ptr[source_idx_mod + 1] << 8) + (ptr[source_idx_mod + 2] << 16);
+            }
+            break;
+        }
+        colors[i] = ColorUtil::to_color(color_value, order, bitness);
       }
-      this->draw_pixel_at(x + x_start, y + y_start, ColorUtil::to_color(color_value, order, bitness));
+      this->blit_span(x + x_start, y + y_start, count, colors);
     }
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
+void HOT Display::fill_span(int x, int y, int width, Color color) {
+  int min_x, max_x;
+  if (!this->clamp_span_(x, y, width, min_x, max_x))
+    return;
+  for (int i = min_x; i != max_x; i++)
     this->draw_pixel_at(i, y, color);
 }
+void HOT Display::blit_span(int x, int y, int width, const Color *colors) {
+  int min_x, max_x;
+  if (!this->clamp_span_(x, y, width, min_x, max_x))
+    return;
+  for (int i = min_x; i != max_x; i++)
+    this->draw_pixel_at(i, y, colors[i - x]);
+}
+void HOT Display::blend_span(int x, int y, int width, const uint8_t *alpha, Color color, Color background) {
+  int min_x, max_x;
+  if (!this->clamp_span_(x, y, width, min_x, max_x))
+    return;
+  Color colors[SPAN_CHUNK_PIXELS];
+  int i = min_x;
+  while (i != max_x) {
+    if (alpha[i - x] == 0) {
+      i++;
+      continue;
+    }
+    // runs of visible pixels are drawn as one span, filled if they're all solid
+    int count = 0;
+    bool solid = true;
+    for (; i + count != max_x && count != SPAN_CHUNK_PIXELS; count++) {
+      const uint8_t pixel_alpha = alpha[i + count - x];
+      if (pixel_alpha == 0)
+        break;
+      solid = solid && pixel_alpha == 255;
+      colors[count] = blend_color(color, background, pixel_alpha);
+    }
+    if (solid) {
+      this->fill_span(i, y, count, color);
+    } else {
+      this->blit_span(i, y, count, colors);
+    }
+    i += count;
+  }
+}
+
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
@@ -102,9 +158,11 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
+  int min_y, max_y;
+  if (!this->clamp_y_(y1, height, min_y, max_y))
+    return;
+  for (int i = min_y; i < max_y; i++) {
+    this->fill_span(x1, i, width, color);
   }
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
@@ -228,6 +228,21 @@ class Display : public PollingComponent {
   /// Set a single pixel at the specified coordinates to the given color.
   virtual void draw_pixel_at(int x, int y, Color color) = 0;
 
+  /** Set the \p width pixels from [x,y] to [x+width-1,y] to the given color.
+   * Like the other span primitives the span is clipped once rather than per pixel, displays that can write a
+   * whole span to their buffer directly override it.
+   */
+  virtual void fill_span(int x, int y, int width, Color color);
+
+  /// Draw the \p width pixels from [x,y] to [x+width-1,y] in the colors of \p colors, one per pixel.
+  virtual void blit_span(int x, int y, int width, const Color *colors);
+
+  /** Blend \p color over \p background in the \p width pixels from [x,y] to [x+width-1,y].
+   * Each pixel is blended by its value in \p alpha: 255 sets \p color, pixels with 0 are left untouched.
+   * The default splits the span in runs of solid and blended pixels and draws them with fill_span() and blit_span().
+   */
+  virtual void blend_span(int x, int y, int width, const uint8_t *alpha, Color color, Color background);
+
   /** Given an array of pixels encoded in the nominated format, draw these into the display's buffer.
    * The naive implementation here will work in all cases, but can be overridden by sub-classes
    * in order to optimise the procedure.
@@ -645,6 +660,11 @@ class Display : public PollingComponent {
  protected:
   bool clamp_x_(int x, int w, int &min_x, int &max_x);
   bool clamp_y_(int y, int h, int &min_y, int &max_y);
+  /// Clip the span of \p width pixels at [x,y] to the display and the clipping rectangle, false if nothing is left.
+  bool clamp_span_(int x, int y, int width, int &min_x, int &max_x) {
+    int min_y, max_y;
+    return this->clamp_y_(y, 1, min_y, max_y) && this->clamp_x_(x, width, min_x, max_x);
+  }
   void vprintf_(int x, int y, BaseFont *font, Color color, Color background, TextAlign align, const char *format,
                 va_list arg);
 
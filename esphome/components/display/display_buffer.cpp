@@ -1,5 +1,7 @@
 #include "display_buffer.h"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -9,6 +11,123 @@ namespace esphome {
 namespace display {
 
 static const char *const TAG = "display";
+/// Most rectangles collected from the tiles before they're merged, more are merged in as they come.
+static const size_t MAX_DIRTY_SCAN_RECTS = 32;
+
+void DirtyRegions::init(int width, int height) {
+  this->width_ = width;
+  this->height_ = height;
+  this->shift_ = 4;
+  while (((width + (1 << this->shift_) - 1) >> this->shift_) > 32)
+    this->shift_++;
+  this->rows_.assign((height + (1 << this->shift_) - 1) >> this->shift_, 0);
+}
+
+void DirtyRegions::mark(int x, int y, int w, int h) {
+  const int x2 = std::min(x + w, int(this->width_));
+  const int y2 = std::min(y + h, int(this->height_));
+  x = std::max(x, 0);
+  y = std::max(y, 0);
+  if (x >= x2 || y >= y2)
+    return;
+  const int first = x >> this->shift_;
+  const int last = (x2 - 1) >> this->shift_;
+  const uint32_t bits = (last - first == 31 ? ~0u : (1u << (last - first + 1)) - 1) << first;
+  for (int ty = y >> this->shift_; ty <= (y2 - 1) >> this->shift_; ty++)
+    this->rows_[ty] |= bits;
+  this->mark(x, y);
+  this->mark(x2 - 1, y2 - 1);
+}
+
+// cost of sending a rectangle on its own
+static inline uint32_t rect_cost_of(const Rect &rect, uint32_t rect_cost) {
+  return uint32_t(rect.w) * uint32_t(rect.h) + rect_cost;
+}
+
+// cost saved by sending the bounding box of a and b instead of both, can be negative
+static inline int32_t merge_gain(const Rect &a, const Rect &b, uint32_t rect_cost) {
+  Rect merged = a;
+  merged.extend(b);
+  return int32_t(rect_cost_of(a, rect_cost) + rect_cost_of(b, rect_cost)) - int32_t(rect_cost_of(merged, rect_cost));
+}
+
+size_t DirtyRegions::take(Rect *rects, size_t max_rects, uint32_t rect_cost) {
+  if (this->is_empty() || max_rects == 0)
+    return 0;
+
+  // Collect runs of changed tiles per row, clipped to the bounding box. Runs covering the same columns as one in the
+  // row above extend that one.
+  Rect found[MAX_DIRTY_SCAN_RECTS];
+  size_t count = 0;
+  const int tile = 1 << this->shift_;
+  for (size_t ty = 0; ty < this->rows_.size(); ty++) {
+    uint32_t bits = this->rows_[ty];
+    this->rows_[ty] = 0;
+    while (bits != 0) {
+      const int first = __builtin_ctz(bits);
+      const uint32_t run = bits >> first;
+      const int length = ~run == 0 ? 32 : __builtin_ctz(~run);
+      bits &= length + first == 32 ? 0 : ~0u << (length + first);
+
+      const int16_t x = std::max(first * tile, int(this->x_low_));
+      const int16_t x2 = std::min((first + length) * tile, this->x_high_ + 1);
+      const int16_t y = std::max(int(ty) * tile, int(this->y_low_));
+      const int16_t y2 = std::min((int(ty) + 1) * tile, this->y_high_ + 1);
+      if (x >= x2 || y >= y2)
+        continue;
+      Rect rect(x, y, x2 - x, y2 - y);
+
+      bool extended = false;
+      for (size_t i = 0; i < count && !extended; i++) {
+        if (found[i].x == rect.x && found[i].w == rect.w && found[i].y2() == rect.y) {
+          found[i].h += rect.h;
+          extended = true;
+        }
+      }
+      if (extended)
+        continue;
+      if (count < MAX_DIRTY_SCAN_RECTS) {
+        found[count++] = rect;
+        continue;
+      }
+      size_t best = 0;
+      int32_t best_gain = INT32_MIN;
+      for (size_t i = 0; i < count; i++) {
+        const int32_t gain = merge_gain(found[i], rect, rect_cost);
+        if (gain > best_gain) {
+          best = i;
+          best_gain = gain;
+        }
+      }
+      found[best].extend(rect);
+    }
+  }
+
+  // Merge the pair that saves the most until no merge saves anything and there are few enough
+  while (count > 1) {
+    size_t best_a = 0, best_b = 1;
+    int32_t best_gain = INT32_MIN;
+    for (size_t a = 0; a < count; a++) {
+      for (size_t b = a + 1; b < count; b++) {
+        const int32_t gain = merge_gain(found[a], found[b], rect_cost);
+        if (gain > best_gain) {
+          best_a = a;
+          best_b = b;
+          best_gain = gain;
+        }
+      }
+    }
+    if (best_gain < 0 && count <= max_rects)
+      break;
+    found[best_a].extend(found[best_b]);
+    found[best_b] = found[--count];
+  }
+
+  std::copy(found, found + count, rects);
+  this->x_low_ = this->y_low_ = INT16_MAX;
+  this->x_high_ = this->y_high_ = -1;
+  return count;
+}
 
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
@@ -17,7 +136,38 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
     ESP_LOGE(TAG, "Could not allocate buffer for display!");
     return;
   }
+  this->dirty_regions_.init(this->get_width_internal(), this->get_height_internal());
   this->clear();
+  // the display doesn't show the buffer yet, even where clearing didn't change it
+  this->dirty_regions_.mark_all();
+}
+
+void DisplayBuffer::fill_buffer_(const uint8_t *pixel, size_t bytes_per_pixel) {
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  uint8_t *data = this->buffer_;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++, data += bytes_per_pixel) {
+      if (data[0] != pixel[0] || (bytes_per_pixel == 2 && data[1] != pixel[1])) {
+        memcpy(data, pixel, bytes_per_pixel);
+        this->dirty_regions_.mark(x, y);
+      }
+    }
+    App.feed_wdt();
+  }
+}
+
+void DisplayBuffer::fill_buffer_span_(int x, int y, int step_x, int step_y, int count, const uint8_t *pixel,
+                                      size_t bytes_per_pixel) {
+  const int width = this->get_width_internal();
+  const int step = (step_x + step_y * width) * int(bytes_per_pixel);
+  uint8_t *data = this->buffer_ + (x + y * width) * bytes_per_pixel;
+  for (int i = 0; i != count; i++, data += step, x += step_x, y += step_y) {
+    if (data[0] != pixel[0] || (bytes_per_pixel == 2 && data[1] != pixel[1])) {
+      memcpy(data, pixel, bytes_per_pixel);
+      this->dirty_regions_.mark(x, y);
+    }
+  }
 }
 
 int DisplayBuffer::get_width() {
@@ -45,8 +195,13 @@ int DisplayBuffer::get_height() {
 }
 
 void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
-  if (!this->get_clipping().inside(x, y))
-    return;  // NOLINT
+  // Clipped like the spans in clamp_x_()/clamp_y_(): the right and bottom edges of the clipping rectangle are outside
+  // of it, and a clipping rectangle that was shrunk to nothing leaves nothing to draw.
+  if (!this->clipping_rectangle_.empty()) {
+    const Rect &rect = this->clipping_rectangle_.back();
+    if (!rect.is_set() || x < rect.x || x >= rect.x2() || y < rect.y || y >= rect.y2())
+      return;  // NOLINT
+  }
 
   switch (this->rotation_) {
     case DISPLAY_ROTATION_0_DEGREES:
@@ -68,5 +223,64 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+void DisplayBuffer::rotate_span_(int &x, int &y, int &step_x, int &step_y) {
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+    default:
+      step_x = 1;
+      step_y = 0;
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      std::swap(x, y);
+      x = this->get_width_internal() - x - 1;
+      step_x = 0;
+      step_y = 1;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      x = this->get_width_internal() - x - 1;
+      y = this->get_height_internal() - y - 1;
+      step_x = -1;
+      step_y = 0;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      std::swap(x, y);
+      y = this->get_height_internal() - y - 1;
+      step_x = 0;
+      step_y = -1;
+      break;
+  }
+}
+
+void HOT DisplayBuffer::fill_span(int x, int y, int width, Color color) {
+  int min_x, max_x, step_x, step_y;
+  if (!this->clamp_span_(x, y, width, min_x, max_x))
+    return;
+  x = min_x;
+  this->rotate_span_(x, y, step_x, step_y);
+  this->fill_absolute_span_internal(x, y, step_x, step_y, max_x - min_x, color);
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::blit_span(int x, int y, int width, const Color *colors) {
+  int min_x, max_x, step_x, step_y;
+  if (!this->clamp_span_(x, y, width, min_x, max_x))
+    return;
+  colors += min_x - x;
+  x = min_x;
+  this->rotate_span_(x, y, step_x, step_y);
+  this->blit_absolute_span_internal(x, y, step_x, step_y, max_x - min_x, colors);
+  App.feed_wdt();
+}
+
+void DisplayBuffer::fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) {
+  for (int i = 0; i != count; i++, x += step_x, y += step_y)
+    this->draw_absolute_pixel_internal(x, y, color);
+}
+
+void DisplayBuffer::blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors) {
+  for (int i = 0; i != count; i++, x += step_x, y += step_y)
+    this->draw_absolute_pixel_internal(x, y, colors[i]);
+}
+
 }  // namespace display
 }  // namespace esphome
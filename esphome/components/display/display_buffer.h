@@ -12,6 +12,52 @@
 namespace esphome {
 namespace display {
 
+/** Records which parts of a display buffer changed since they were last sent to the display.
+ *
+ * The buffer is divided in square tiles, small enough that a row of tiles fits in 32 bits, plus the exact bounding
+ * box of all changes. Drivers mark the pixels they change and take the changed tiles as a few rectangles when they
+ * flush, so two small updates at opposite corners don't make them send everything in between. Rectangles are merged
+ * as long as sending the merged one is cheaper than sending both, given what starting a new rectangle costs.
+ */
+class DirtyRegions {
+ public:
+  void init(int width, int height);
+
+  inline void mark(int x, int y) ESPHOME_ALWAYS_INLINE {
+    this->rows_[y >> this->shift_] |= 1u << (x >> this->shift_);
+    if (x < this->x_low_)
+      this->x_low_ = x;
+    if (x > this->x_high_)
+      this->x_high_ = x;
+    if (y < this->y_low_)
+      this->y_low_ = y;
+    if (y > this->y_high_)
+      this->y_high_ = y;
+  }
+  /// Mark the \p w x \p h pixels at \p x, \p y, clipped to the buffer.
+  void mark(int x, int y, int w, int h);
+  void mark_all() { this->mark(0, 0, this->width_, this->height_); }
+  bool is_empty() const { return this->x_high_ < this->x_low_; }
+
+  /** Take the changed regions as at most \p max_rects rectangles and clear them.
+   *
+   * @param rect_cost What sending a rectangle costs on top of its pixels, in pixels that could be sent instead.
+   * @return The number of rectangles written to \p rects.
+   */
+  size_t take(Rect *rects, size_t max_rects, uint32_t rect_cost);
+
+ protected:
+  /// Changed tiles, one bit per tile column for each row of tiles.
+  std::vector<uint32_t> rows_;
+  uint8_t shift_{4};
+  int16_t width_{0};
+  int16_t height_{0};
+  int16_t x_low_{INT16_MAX};
+  int16_t y_low_{INT16_MAX};
+  int16_t x_high_{-1};
+  int16_t y_high_{-1};
+};
+
 class DisplayBuffer : public Display {
  public:
   /// Get the width of the image in pixels with rotation applied.
@@ -22,12 +68,59 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  void fill_span(int x, int y, int width, Color color) override;
+  void blit_span(int x, int y, int width, const Color *colors) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /** Draw \p count pixels of a span in buffer coordinates, starting at [x,y] and moving by \p step_x, \p step_y.
+   *
+   * The span is already clipped and rotated, so it runs along a buffer row or column in either direction. The
+   * defaults draw each pixel with draw_absolute_pixel_internal(), buffers that know their format override them.
+   */
+  virtual void fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color);
+  virtual void blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors);
+
   void init_internal_(uint32_t buffer_length);
+  /** Fill the buffer with pixels of \p bytes_per_pixel bytes, only marking the pixels that change as dirty.
+   *
+   * Buffers that are cleared and redrawn every update then only send what really changed.
+   */
+  void fill_buffer_(const uint8_t *pixel, size_t bytes_per_pixel);
+  /// Like fill_buffer_(), but only for the pixels of a span as passed to fill_absolute_span_internal().
+  void fill_buffer_span_(int x, int y, int step_x, int step_y, int count, const uint8_t *pixel, size_t bytes_per_pixel);
+  /** Write the pixels of a span as passed to blit_absolute_span_internal() to the buffer, only marking the pixels that
+   * change. \p encode converts a color to the value of a pixel of \p bytes_per_pixel bytes (1 or 2, high byte first).
+   */
+  template<typename F>
+  void blit_buffer_span_(int x, int y, int step_x, int step_y, int count, const Color *colors,
+                         size_t bytes_per_pixel, F encode) {
+    const int width = this->get_width_internal();
+    const int step = (step_x + step_y * width) * int(bytes_per_pixel);
+    uint8_t *data = this->buffer_ + (x + y * width) * bytes_per_pixel;
+    for (int i = 0; i != count; i++, data += step, x += step_x, y += step_y) {
+      const uint16_t value = encode(colors[i]);
+      if (bytes_per_pixel == 2) {
+        const uint8_t high = value >> 8, low = value;
+        if (data[0] == high && data[1] == low)
+          continue;
+        data[0] = high;
+        data[1] = low;
+      } else {
+        if (data[0] == uint8_t(value))
+          continue;
+        data[0] = value;
+      }
+      this->dirty_regions_.mark(x, y);
+    }
+  }
+  /// Rotate the start of a clipped span to buffer coordinates and get the direction it runs in there.
+  void rotate_span_(int &x, int &y, int &step_x, int &step_y);
 
   uint8_t *buffer_{nullptr};
+  /// Pixels changed since the driver last sent them, drivers that only send those mark them.
+  DirtyRegions dirty_regions_;
 };
 
 }  // namespace display
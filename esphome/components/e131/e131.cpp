@@ -1,6 +1,7 @@
 #include "e131.h"
 #ifdef USE_NETWORK
 #include "e131_addressable_light_effect.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -8,6 +9,9 @@ namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+static const int DDP_PORT = 4048;
+/// Packets taken from each socket per loop() call at most, so a flood can't hold up everything else.
+static const int MAX_PACKETS_PER_LOOP = 16;
 
 E131Component::E131Component() {}
 
@@ -15,63 +19,115 @@ E131Component::~E131Component() {
   if (this->socket_) {
     this->socket_->close();
   }
+  if (this->ddp_socket_) {
+    this->ddp_socket_->close();
+  }
 }
 
-void E131Component::setup() {
-  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+static std::unique_ptr<socket::Socket> bind_udp_socket(int port) {
+  auto sock = socket::socket_ip_loop_monitored(SOCK_DGRAM, IPPROTO_IP);
+  if (sock == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket: errno %d", errno);
+    return nullptr;
+  }
 
   int enable = 1;
-  int err = this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  int err = sock->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to set reuseaddr: errno %d", err);
     // we can still continue
   }
-  err = this->socket_->setblocking(false);
+  err = sock->setblocking(false);
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
-    this->mark_failed();
-    return;
+    return nullptr;
   }
 
   struct sockaddr_storage server;
 
-  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), PORT);
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), port);
   if (sl == 0) {
     ESP_LOGW(TAG, "Socket unable to set sockaddr: errno %d", errno);
-    this->mark_failed();
-    return;
+    return nullptr;
   }
 
-  err = this->socket_->bind((struct sockaddr *) &server, sizeof(server));
+  err = sock->bind((struct sockaddr *) &server, sizeof(server));
   if (err != 0) {
     ESP_LOGW(TAG, "Socket unable to bind: errno %d", errno);
+    return nullptr;
+  }
+  return sock;
+}
+
+void E131Component::setup() {
+  this->socket_ = bind_udp_socket(PORT);
+  if (this->socket_ == nullptr) {
     this->mark_failed();
     return;
   }
+  if (this->ddp_) {
+    this->ddp_socket_ = bind_udp_socket(DDP_PORT);
+    if (this->ddp_socket_ == nullptr) {
+      this->mark_failed();
+      return;
+    }
+  }
 
   join_igmp_groups_();
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
-  E131Packet packet;
-  int universe = 0;
-  uint8_t buf[1460];
+  this->read_packets_(this->socket_.get(), &E131Component::handle_e131_);
+  if (this->ddp_socket_ != nullptr)
+    this->read_packets_(this->ddp_socket_.get(), &E131Component::handle_ddp_);
+
+  const uint32_t now = millis();
+  for (auto *light_effect : this->light_effects_) {
+    light_effect->check_sync_timeout_(now);
+  }
+}
 
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
+void E131Component::read_packets_(socket::Socket *socket,
+                                  void (E131Component::*handler)(const uint8_t *, size_t)) {
+  if (!socket->ready())
     return;
+
+  // All universes of a frame usually arrive together, taking them in one go lets them be shown together
+  uint8_t buf[1460];
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    ssize_t len = socket->read(buf, sizeof(buf));
+    if (len <= 0)
+      return;
+    (this->*handler)(buf, len);
   }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
+}
 
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
+void E131Component::handle_e131_(const uint8_t *data, size_t len) {
+  E131Packet packet;
+  int universe = 0;
+  uint16_t sync_address = 0;
+
+  if (this->packet_(data, len, universe, packet)) {
+    if (!this->process_(universe, packet)) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+    }
+  } else if (this->sync_packet_(data, len, sync_address)) {
+    this->process_sync_(sync_address);
+  } else {
+    ESP_LOGV(TAG, "Invalid packet received of size %zu.", len);
+  }
+}
+
+void E131Component::handle_ddp_(const uint8_t *data, size_t len) {
+  DDPPacket packet;
+  if (!this->ddp_packet_(data, len, packet)) {
+    ESP_LOGV(TAG, "Invalid DDP packet received of size %zu.", len);
     return;
   }
 
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+  ESP_LOGV(TAG, "Received DDP packet for offset %" PRIu32 ", with %u bytes", packet.offset, packet.length);
+  for (auto *light_effect : light_effects_) {
+    light_effect->process_ddp_(packet);
   }
 }
 
@@ -103,6 +159,11 @@ void E131Component::remove_effect(E131AddressableLightEffect *light_effect) {
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
     leave_(universe);
   }
+
+  if (light_effects_.empty() && this->sync_universe_ != 0) {
+    leave_(this->sync_universe_);
+    this->sync_universe_ = 0;
+  }
 }
 
 bool E131Component::process_(int universe, const E131Packet &packet) {
@@ -114,9 +175,25 @@ bool E131Component::process_(int universe, const E131Packet &packet) {
     handled = light_effect->process_(universe, packet) || handled;
   }
 
+  // The sync packets are sent to the multicast group of their own universe, so that one has to be joined as well
+  if (handled && packet.sync_address != 0 && packet.sync_address != this->sync_universe_) {
+    if (this->sync_universe_ != 0)
+      leave_(this->sync_universe_);
+    this->sync_universe_ = packet.sync_address;
+    join_(this->sync_universe_);
+  }
+
   return handled;
 }
 
+void E131Component::process_sync_(uint16_t sync_address) {
+  ESP_LOGV(TAG, "Received E1.31 sync packet for %u universe", sync_address);
+
+  for (auto *light_effect : light_effects_) {
+    light_effect->process_sync_(sync_address);
+  }
+}
+
 }  // namespace e131
 }  // namespace esphome
 #endif
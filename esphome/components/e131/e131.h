@@ -8,7 +8,6 @@
 #include <map>
 #include <memory>
 #include <set>
-#include <vector>
 
 namespace esphome {
 namespace e131 {
@@ -19,9 +18,23 @@ enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
+/// A data packet, parsed in place: values points into the receive buffer.
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  /// Universe of the sync packets to wait for before showing the data, 0 to show it right away.
+  uint16_t sync_address;
+  /// The start code followed by the DMX data.
+  const uint8_t *values;
+};
+
+/// A DDP data packet, parsed in place.
+struct DDPPacket {
+  /// Offset of the data within the channels of the whole display, in bytes.
+  uint32_t offset;
+  uint16_t length;
+  /// Set on the last packet of a frame, the frame should be shown then.
+  bool push;
+  const uint8_t *data;
 };
 
 class E131Component : public esphome::Component {
@@ -37,19 +50,30 @@ class E131Component : public esphome::Component {
   void remove_effect(E131AddressableLightEffect *light_effect);
 
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
+  void set_ddp(bool ddp) { this->ddp_ = ddp; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  /// Handle all packets waiting on \p socket with \p handler, they're parsed where they were received.
+  void read_packets_(socket::Socket *socket, void (E131Component::*handler)(const uint8_t *, size_t));
+  void handle_e131_(const uint8_t *data, size_t len);
+  void handle_ddp_(const uint8_t *data, size_t len);
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  bool sync_packet_(const uint8_t *data, size_t len, uint16_t &sync_address);
+  bool ddp_packet_(const uint8_t *data, size_t len, DDPPacket &packet);
   bool process_(int universe, const E131Packet &packet);
+  void process_sync_(uint16_t sync_address);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
 
   E131ListenMethod listen_method_{E131_MULTICAST};
+  bool ddp_{false};
   std::unique_ptr<socket::Socket> socket_;
+  std::unique_ptr<socket::Socket> ddp_socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  /// Universe of the sync packets the effects wait for, joined like the data universes. 0 if none.
+  uint16_t sync_universe_{0};
 };
 
 }  // namespace e131
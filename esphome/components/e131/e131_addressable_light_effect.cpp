@@ -1,13 +1,20 @@
 #include "e131_addressable_light_effect.h"
 #include "e131.h"
 #ifdef USE_NETWORK
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = E131_MAX_PROPERTY_VALUES_COUNT - 1;
+/// Pixels converted on the stack before they're handed to the light at once.
+static const int32_t WRITE_CHUNK_SIZE = 64;
+/// E131_NETWORK_DATA_LOSS_TIMEOUT: synchronized data is shown without its sync packet after this long.
+static const uint32_t SYNC_TIMEOUT_MS = 2500;
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -37,6 +44,12 @@ void E131AddressableLightEffect::stop() {
   if (this->e131_) {
     this->e131_->remove_effect(this);
   }
+  this->sync_pending_ = false;
+  this->sync_lost_ = false;
+  this->staged_from_ = INT32_MAX;
+  this->staged_to_ = 0;
+  this->staging_.clear();
+  this->staging_.shrink_to_fit();
 
   AddressableLightEffect::stop();
 }
@@ -54,41 +67,103 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
 
   int32_t output_offset = (universe - first_universe_) * get_lights_per_universe();
   // limit amount of lights per universe and received
-  int output_end =
-      std::min(it->size(), std::min(output_offset + get_lights_per_universe(), output_offset + packet.count - 1));
-  auto *input_data = packet.values + 1;
-
-  ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%d.", get_name().c_str(), universe,
-           output_offset, output_end);
-
-  switch (channels_) {
-    case E131_MONO:
-      for (; output_offset < output_end; output_offset++, input_data++) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[0], input_data[0], input_data[0]));
-      }
-      break;
-
-    case E131_RGB:
-      for (; output_offset < output_end; output_offset++, input_data += 3) {
-        auto output = (*it)[output_offset];
-        output.set(
-            Color(input_data[0], input_data[1], input_data[2], (input_data[0] + input_data[1] + input_data[2]) / 3));
-      }
-      break;
-
-    case E131_RGBW:
-      for (; output_offset < output_end; output_offset++, input_data += 4) {
-        auto output = (*it)[output_offset];
-        output.set(Color(input_data[0], input_data[1], input_data[2], input_data[3]));
-      }
-      break;
+  int32_t data_size = std::min<int32_t>(packet.count - 1, get_data_per_universe());
+
+  ESP_LOGV(TAG, "Applying data for '%s' on %d universe, for %" PRId32 "-%" PRId32 ".", get_name().c_str(), universe,
+           output_offset, std::min<int32_t>(it->size(), output_offset + data_size / channels_));
+
+  if (packet.sync_address != 0)
+    this->sync_address_ = packet.sync_address;
+  if (packet.sync_address == 0 || this->sync_lost_) {
+    // data that isn't synchronized replaces whatever was waiting for a sync packet
+    this->sync_pending_ = false;
+    this->staged_from_ = INT32_MAX;
+    this->staged_to_ = 0;
+    this->write_channels_(output_offset, packet.values + 1, data_size);
+    it->schedule_show();
+    return true;
   }
 
-  it->schedule_show();
+  // The other universes of the frame are still coming, keep the data aside until the sync packet arrives so the
+  // light doesn't show (or send) a half updated frame in the meantime
+  if (this->staging_.empty())
+    this->staging_.resize(get_universe_count() * get_data_per_universe());
+  if (!this->sync_pending_)
+    this->pending_since_ = millis();
+  this->sync_pending_ = true;
+  memcpy(this->staging_.data() + output_offset * channels_, packet.values + 1, data_size);
+  this->staged_from_ = std::min(this->staged_from_, output_offset);
+  this->staged_to_ = std::max(this->staged_to_, output_offset + data_size / channels_);
   return true;
 }
 
+void E131AddressableLightEffect::process_sync_(uint16_t sync_address) {
+  if (sync_address != this->sync_address_)
+    return;
+
+  this->sync_lost_ = false;
+  if (this->sync_pending_)
+    this->show_staged_();
+}
+
+void E131AddressableLightEffect::check_sync_timeout_(uint32_t now) {
+  if (!this->sync_pending_ || now - this->pending_since_ < SYNC_TIMEOUT_MS)
+    return;
+
+  ESP_LOGW(TAG, "No sync packet for universe %u on '%s', showing data without it.", this->sync_address_,
+           get_name().c_str());
+  this->sync_lost_ = true;
+  this->show_staged_();
+}
+
+void E131AddressableLightEffect::show_staged_() {
+  if (this->staged_from_ < this->staged_to_) {
+    this->write_channels_(this->staged_from_, this->staging_.data() + this->staged_from_ * channels_,
+                          (this->staged_to_ - this->staged_from_) * channels_);
+  }
+  this->sync_pending_ = false;
+  this->staged_from_ = INT32_MAX;
+  this->staged_to_ = 0;
+  get_addressable_()->schedule_show();
+}
+
+void E131AddressableLightEffect::process_ddp_(const DDPPacket &packet) {
+  // DDP addresses channel bytes, data that doesn't start at one of our pixels is skipped
+  const uint32_t first_led = packet.offset / channels_;
+  if (packet.offset % channels_ == 0 && first_led < static_cast<uint32_t>(get_addressable_()->size()))
+    this->write_channels_(first_led, packet.data, packet.length);
+
+  if (packet.push)
+    get_addressable_()->schedule_show();
+}
+
+void E131AddressableLightEffect::write_channels_(int32_t first_led, const uint8_t *data, size_t size) {
+  auto *it = get_addressable_();
+  const int32_t end = std::min<int32_t>(it->size(), first_led + size / channels_);
+
+  Color colors[WRITE_CHUNK_SIZE];
+  for (int32_t led = first_led; led < end; led += WRITE_CHUNK_SIZE) {
+    const int32_t count = std::min(end - led, WRITE_CHUNK_SIZE);
+    switch (channels_) {
+      case E131_MONO:
+        for (int32_t i = 0; i < count; i++, data++)
+          colors[i] = Color(data[0], data[0], data[0], data[0]);
+        break;
+
+      case E131_RGB:
+        for (int32_t i = 0; i < count; i++, data += 3)
+          colors[i] = Color(data[0], data[1], data[2], (data[0] + data[1] + data[2]) / 3);
+        break;
+
+      case E131_RGBW:
+        for (int32_t i = 0; i < count; i++, data += 4)
+          colors[i] = Color(data[0], data[1], data[2], data[3]);
+        break;
+    }
+    it->write_span(led, colors, count);
+  }
+}
+
 }  // namespace e131
 }  // namespace esphome
 #endif
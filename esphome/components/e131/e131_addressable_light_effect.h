@@ -3,11 +3,14 @@
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
 #ifdef USE_NETWORK
+#include <vector>
+
 namespace esphome {
 namespace e131 {
 
 class E131Component;
 struct E131Packet;
+struct DDPPacket;
 
 enum E131LightChannels { E131_MONO = 1, E131_RGB = 3, E131_RGBW = 4 };
 
@@ -31,11 +34,32 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  void process_sync_(uint16_t sync_address);
+  void process_ddp_(const DDPPacket &packet);
+  /// Show the data waiting for its sync packet if that has been missing for too long.
+  void check_sync_timeout_(uint32_t now);
+  /// Write the data waiting for its sync packet to the LEDs and show it.
+  void show_staged_();
+  /// Write \p size bytes of channel data to the LEDs from \p first_led on.
+  void write_channels_(int32_t first_led, const uint8_t *data, size_t size);
 
   int first_universe_{0};
   int last_universe_{0};
   E131LightChannels channels_{E131_RGB};
   E131Component *e131_{nullptr};
+  /// Sync address of the last synchronized data packet.
+  uint16_t sync_address_{0};
+  /// Data in staging_ is waiting for its sync packet.
+  bool sync_pending_{false};
+  /// When the first data of the pending frame arrived.
+  uint32_t pending_since_{0};
+  /// Set when the sync packets stopped coming, synchronized data is shown right away until they're back.
+  bool sync_lost_{false};
+  /// Channel data of the universes waiting for their sync packet, allocated once the first one arrives.
+  std::vector<uint8_t> staging_;
+  /// LEDs in staging_ that were received for the pending frame.
+  int32_t staged_from_{INT32_MAX};
+  int32_t staged_to_{0};
 
   friend class E131Component;
 };
@@ -37,9 +37,20 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
-  RAMAllocator<rmt_item32_t> rmt_allocator(this->use_psram_ ? 0 : RAMAllocator<rmt_item32_t>::ALLOC_INTERNAL);
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8 +
-                                          1);  // 8 bits per byte, 1 rmt_item32_t per bit + 1 rmt_item32_t for reset
+  if (this->double_buffer_) {
+    // Read by the RMT interrupt, which can't access PSRAM
+    RAMAllocator<uint8_t> internal_allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+    this->front_buf_ = internal_allocator.allocate(buffer_size);
+    if (this->front_buf_ == nullptr) {
+      ESP_LOGE(TAG, "Cannot allocate LED front buffer!");
+      this->mark_failed();
+      return;
+    }
+  } else {
+    RAMAllocator<rmt_item32_t> rmt_allocator(this->use_psram_ ? 0 : RAMAllocator<rmt_item32_t>::ALLOC_INTERNAL);
+    this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8 +
+                                            1);  // 8 bits per byte, 1 rmt_item32_t per bit + 1 rmt_item32_t for reset
+  }
 
   rmt_config_t config;
   memset(&config, 0, sizeof(config));
@@ -64,6 +75,24 @@ void ESP32RMTLEDStripLightOutput::setup() {
     this->mark_failed();
     return;
   }
+
+  if (this->double_buffer_) {
+    this->latch_ = this->reset_;
+    if (this->latch_.duration0 == 0 && this->latch_.duration1 == 0) {
+      // Same pause as write_state() makes without double buffering, as an item so it's part of the transmission
+      const uint32_t ticks = RMT_CLK_FREQ / RMT_CLK_DIV / 1000000 * 50;
+      this->latch_.duration0 = ticks / 2;
+      this->latch_.level0 = 0;
+      this->latch_.duration1 = ticks / 2;
+      this->latch_.level1 = 0;
+    }
+    if (rmt_translator_init(this->channel_, rmt_translate_) != ESP_OK ||
+        rmt_translator_set_context(this->channel_, this) != ESP_OK) {
+      ESP_LOGE(TAG, "Cannot initialize RMT translator!");
+      this->mark_failed();
+      return;
+    }
+  }
 }
 
 void ESP32RMTLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bit0_low, uint32_t bit1_high,
@@ -95,6 +124,41 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
     this->schedule_show();
     return;
   }
+
+  if (this->double_buffer_) {
+    if (rmt_wait_tx_done(this->channel_, 0) != ESP_OK) {
+      // Still sending the last frame, send this one once that's done. If another frame is rendered before then, this
+      // one is dropped, see schedule_show().
+      if (this->dirty_from_ < this->dirty_to_) {
+        this->frame_pending_ = true;
+        this->frame_replaced_ = false;
+      }
+      AddressableLight::schedule_show();
+      return;
+    }
+    int32_t from, to;
+    if (!this->take_dirty_range_(from, to))
+      return;
+    this->last_refresh_ = now;
+    this->mark_shown_();
+    ESP_LOGVV(TAG, "Writing RGB values to bus...");
+    // the front buffer still holds the last frame, only the changed LEDs need to be copied
+    const size_t bytes_per_led = this->get_buffer_size_() / this->num_leds_;
+    memcpy(this->front_buf_ + from * bytes_per_led, this->buf_ + from * bytes_per_led, (to - from) * bytes_per_led);
+    if (rmt_write_sample(this->channel_, this->front_buf_, this->get_buffer_size_(), false) != ESP_OK) {
+      ESP_LOGE(TAG, "RMT TX error");
+      this->status_set_warning();
+      return;
+    }
+    this->frame_pending_ = false;
+    this->frame_sent_(now);
+    this->status_clear_warning();
+    return;
+  }
+
+  int32_t from, to;
+  if (!this->take_dirty_range_(from, to))
+    return;
   this->last_refresh_ = now;
   this->mark_shown_();
 
@@ -103,30 +167,30 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
   if (rmt_wait_tx_done(this->channel_, pdMS_TO_TICKS(1000)) != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX timeout");
     this->status_set_warning();
+    // these LEDs haven't been encoded yet
+    this->mark_dirty(from, to);
     return;
   }
   delayMicroseconds(50);
 
-  size_t buffer_size = this->get_buffer_size_();
-
-  size_t size = 0;
-  size_t len = 0;
-  uint8_t *psrc = this->buf_;
-  rmt_item32_t *pdest = this->rmt_buf_;
-  while (size < buffer_size) {
+  // The items of the LEDs that didn't change are still in the RMT buffer from the last frame, only encode the others
+  const size_t buffer_size = this->get_buffer_size_();
+  const size_t bytes_per_led = buffer_size / this->num_leds_;
+  const size_t end = to * bytes_per_led;
+  uint8_t *psrc = this->buf_ + from * bytes_per_led;
+  rmt_item32_t *pdest = this->rmt_buf_ + from * bytes_per_led * 8;
+  for (size_t size = from * bytes_per_led; size < end; size++) {
     uint8_t b = *psrc;
     for (int i = 0; i < 8; i++) {
       pdest->val = b & (1 << (7 - i)) ? this->bit1_.val : this->bit0_.val;
       pdest++;
-      len++;
     }
-    size++;
     psrc++;
   }
 
+  size_t len = buffer_size * 8;
   if (this->reset_.duration0 > 0 || this->reset_.duration1 > 0) {
-    pdest->val = this->reset_.val;
-    pdest++;
+    this->rmt_buf_[len].val = this->reset_.val;
     len++;
   }
 
@@ -135,10 +199,67 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
     this->status_set_warning();
     return;
   }
+  this->frame_sent_(now);
   this->status_clear_warning();
 }
 
-light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
+void IRAM_ATTR ESP32RMTLEDStripLightOutput::rmt_translate_(const void *src, rmt_item32_t *dest, size_t src_size,
+                                                           size_t wanted_num, size_t *translated_size,
+                                                           size_t *item_num) {
+  void *context = nullptr;
+  rmt_translator_get_context(item_num, &context);
+  const auto *light = static_cast<const ESP32RMTLEDStripLightOutput *>(context);
+  const auto *psrc = static_cast<const uint8_t *>(src);
+
+  size_t size = 0;
+  size_t num = 0;
+  while (size < src_size) {
+    // The latch goes right after the last byte, so only take that byte once there's room for both
+    const bool last = size == src_size - 1;
+    if (num + 8 + (last ? 1 : 0) > wanted_num)
+      break;
+    uint8_t b = psrc[size];
+    for (int i = 0; i < 8; i++) {
+      dest[num].val = b & (1 << (7 - i)) ? light->bit1_.val : light->bit0_.val;
+      num++;
+    }
+    size++;
+    if (last) {
+      dest[num].val = light->latch_.val;
+      num++;
+    }
+  }
+  *translated_size = size;
+  *item_num = num;
+}
+
+void ESP32RMTLEDStripLightOutput::schedule_show() {
+  // A new frame replaces the one that has been waiting for the bus, so that one is never shown. Count it only once, a
+  // frame can ask to be shown more than once while it's rendered.
+  if (this->frame_pending_ && !this->frame_replaced_) {
+    this->frame_replaced_ = true;
+    this->dropped_frames_++;
+  }
+  AddressableLight::schedule_show();
+}
+
+void ESP32RMTLEDStripLightOutput::frame_sent_(uint32_t now) {
+  this->frames_in_window_++;
+  const uint32_t elapsed = now - this->frame_window_start_;
+  if (elapsed >= 1000000) {
+    this->frames_per_second_ = this->frames_in_window_ * 1e6f / elapsed;
+    this->frames_in_window_ = 0;
+    this->frame_window_start_ = now;
+  }
+}
+
+float ESP32RMTLEDStripLightOutput::get_frames_per_second() const {
+  if (micros() - this->frame_window_start_ >= 2000000)
+    return 0.0f;
+  return this->frames_per_second_;
+}
+
+light::PixelBuffer ESP32RMTLEDStripLightOutput::get_pixel_buffer_() const {
   int32_t r = 0, g = 0, b = 0;
   switch (this->rgb_order_) {
     case ORDER_RGB:
@@ -172,13 +293,24 @@ light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index
       b = 0;
       break;
   }
-  uint8_t multiplier = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
-  uint8_t white = this->is_wrgb_ ? 0 : 3;
+  light::PixelBuffer buffer;
+  buffer.data = this->buf_;
+  buffer.stride = this->is_rgbw_ || this->is_wrgb_ ? 4 : 3;
+  buffer.red = r + this->is_wrgb_;
+  buffer.green = g + this->is_wrgb_;
+  buffer.blue = b + this->is_wrgb_;
+  if (this->is_rgbw_ || this->is_wrgb_)
+    buffer.white = this->is_wrgb_ ? 0 : 3;
+  return buffer;
+}
 
-  return {this->buf_ + (index * multiplier) + r + this->is_wrgb_,
-          this->buf_ + (index * multiplier) + g + this->is_wrgb_,
-          this->buf_ + (index * multiplier) + b + this->is_wrgb_,
-          this->is_rgbw_ || this->is_wrgb_ ? this->buf_ + (index * multiplier) + white : nullptr,
+light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
+  const light::PixelBuffer buffer = this->get_pixel_buffer_();
+  uint8_t *pixel = buffer.data + index * buffer.stride;
+  return {pixel + buffer.red,
+          pixel + buffer.green,
+          pixel + buffer.blue,
+          buffer.white >= 0 ? pixel + buffer.white : nullptr,
           &this->effect_data_[index],
           &this->correction_};
 }
@@ -214,6 +346,7 @@ void ESP32RMTLEDStripLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "  RGB Order: %s", rgb_order);
   ESP_LOGCONFIG(TAG, "  Max refresh rate: %" PRIu32, *this->max_refresh_rate_);
   ESP_LOGCONFIG(TAG, "  Number of LEDs: %u", this->num_leds_);
+  ESP_LOGCONFIG(TAG, "  Double buffer: %s", YESNO(this->double_buffer_));
 }
 
 float ESP32RMTLEDStripLightOutput::get_setup_priority() const { return setup_priority::HARDWARE; }
@@ -28,6 +28,7 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
  public:
   void setup() override;
   void write_state(light::LightState *state) override;
+  void schedule_show() override;
   float get_setup_priority() const override;
 
   int32_t size() const override { return this->num_leds_; }
@@ -46,6 +47,8 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   void set_is_rgbw(bool is_rgbw) { this->is_rgbw_ = is_rgbw; }
   void set_is_wrgb(bool is_wrgb) { this->is_wrgb_ = is_wrgb; }
   void set_use_psram(bool use_psram) { this->use_psram_ = use_psram; }
+  /// Send frames from a second buffer while the next one is rendered, instead of converting them to RMT items first.
+  void set_double_buffer(bool double_buffer) { this->double_buffer_ = double_buffer; }
 
   /// Set a maximum refresh rate in µs as some lights do not like being updated too often.
   void set_max_refresh_rate(uint32_t interval_us) { this->max_refresh_rate_ = interval_us; }
@@ -63,27 +66,53 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
   void dump_config() override;
 
+  /// Frames sent per second over the last second, 0 if nothing was sent for a while.
+  float get_frames_per_second() const;
+  /// Frames that were never sent because a newer one was rendered while the previous one was still being sent (only
+  /// with double buffering).
+  uint32_t get_dropped_frames() const { return this->dropped_frames_; }
+
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  light::PixelBuffer get_pixel_buffer_() const override;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
+  void frame_sent_(uint32_t now);
+
+  /// Encodes the front buffer into RMT items while it's being sent, called from the RMT interrupt.
+  static void rmt_translate_(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                             size_t *translated_size, size_t *item_num);
 
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
   rmt_item32_t *rmt_buf_{nullptr};
+  /// Copy of buf_ that is being sent, only with double buffering.
+  uint8_t *front_buf_{nullptr};
 
   uint8_t pin_;
   uint16_t num_leds_;
   bool is_rgbw_;
   bool is_wrgb_;
   bool use_psram_;
+  bool double_buffer_{false};
 
   rmt_item32_t bit0_, bit1_, reset_;
+  /// Sent after every frame with double buffering, the reset item or a 50us low if the chipset has none.
+  rmt_item32_t latch_;
   RGBOrder rgb_order_;
   rmt_channel_t channel_;
 
   uint32_t last_refresh_{0};
   optional<uint32_t> max_refresh_rate_{};
+
+  uint32_t dropped_frames_{0};
+  /// A frame is waiting for the previous one to finish sending.
+  bool frame_pending_{false};
+  /// The waiting frame has been rendered over and counted as dropped.
+  bool frame_replaced_{false};
+  uint32_t frames_in_window_{0};
+  uint32_t frame_window_start_{0};
+  float frames_per_second_{0.0f};
 };
 
 }  // namespace esp32_rmt_led_strip
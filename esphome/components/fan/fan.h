@@ -123,7 +123,7 @@ class Fan : public EntityBase {
   FanCall make_call();
 
   /// Register a callback that will be called each time the state changes.
-  void add_on_state_callback(std::function<void()> &&callback);
+  void add_on_state_callback(InlineFunction<void()> &&callback);
 
   void publish_state();
 
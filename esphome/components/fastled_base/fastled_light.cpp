@@ -30,6 +30,9 @@ void FastLEDLightOutput::write_state(light::LightState *state) {
     this->schedule_show();
     return;
   }
+  int32_t from, to;
+  if (!this->take_dirty_range_(from, to))
+    return;
   this->last_refresh_ = now;
   this->mark_shown_();
 
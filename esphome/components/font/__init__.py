@@ -1,4 +1,7 @@
+from __future__ import annotations
+
 from collections.abc import Iterable
+from dataclasses import dataclass
 import functools
 import hashlib
 import logging
@@ -526,13 +529,87 @@ def load_ttf_font(path, size):
     return TrueTypeFontWrapper(font)
 
 
+@dataclass
 class GlyphInfo:
-    def __init__(self, data_len, offset_x, offset_y, width, height):
-        self.data_len = data_len
-        self.offset_x = offset_x
-        self.offset_y = offset_y
-        self.width = width
-        self.height = height
+    data_len: int | None
+    spans_pos: int
+    offset_x: int
+    offset_y: int
+    width: int
+    height: int
+
+
+# Glyph span encoding, see Font::print(). Each byte starts a span of 1 to 64 pixels,
+# the upper two bits tell what kind and the lower six the length minus one.
+SPAN_SKIP = 0x00
+SPAN_SOLID = 0x40
+SPAN_SHADED = 0x80
+# Apart from SPAN_END_ROW, the last kind is a short skip followed by a short solid span,
+# their lengths are in bits 3-5 (0 to 7) and 0-2 (1 to 8).
+SPAN_SKIP_SOLID = 0xC0
+SPAN_END_ROW = 0xC0
+SPAN_MAX_LENGTH = 64
+SPAN_MAX_SHORT_SKIP = 7
+SPAN_MAX_SHORT_SOLID = 8
+# Solid runs up to this long are cheaper to store as part of the shaded run around them
+SPAN_MAX_INLINE_SOLID = 2
+
+
+def encode_glyph_spans(rows: list[list[int]], max_value: int) -> list[int]:
+    """
+    Encode the pixels of a glyph as spans, row by row.
+    Transparent pixels are skipped and runs of fully covered pixels become solid spans. The
+    pixel values of a shaded span follow it, one byte per pixel. Trailing transparent pixels
+    of a row are dropped and each row ends with SPAN_END_ROW.
+    """
+    data = []
+    for row in rows:
+        end = len(row)
+        while end > 0 and row[end - 1] == 0:
+            end -= 1
+        skip = 0
+        x = 0
+        while x < end:
+            value = row[x]
+            length = 1
+            while x + length < end and row[x + length] == value:
+                length += 1
+            if value == 0:
+                skip = length
+                x += length
+                continue
+            if value == max_value:
+                kind = SPAN_SOLID
+                if 0 < skip <= SPAN_MAX_SHORT_SKIP and length <= SPAN_MAX_SHORT_SOLID:
+                    data.append(SPAN_SKIP_SOLID | skip << 3 | (length - 1))
+                    skip = 0
+                    x += length
+                    continue
+            else:
+                kind = SPAN_SHADED
+                # take in everything up to the next transparent pixel or long solid run
+                length = 0
+                while x + length < end and row[x + length] != 0:
+                    solid = 0
+                    while (
+                        x + length + solid < end
+                        and row[x + length + solid] == max_value
+                    ):
+                        solid += 1
+                    if solid > SPAN_MAX_INLINE_SOLID:
+                        break
+                    length += max(solid, 1)
+            for start in range(x - skip, x, SPAN_MAX_LENGTH):
+                data.append(SPAN_SKIP | (min(SPAN_MAX_LENGTH, x - start) - 1))
+            skip = 0
+            for start in range(x, x + length, SPAN_MAX_LENGTH):
+                count = min(SPAN_MAX_LENGTH, x + length - start)
+                data.append(kind | (count - 1))
+                if kind == SPAN_SHADED:
+                    data += row[start : start + count]
+            x += length
+        data.append(SPAN_END_ROW)
+    return data
 
 
 async def to_code(config):
@@ -574,23 +651,36 @@ async def to_code(config):
     else:
         mode = "L"
         scale = 256 // (1 << bpp)
+    max_value = (1 << bpp) - 1
+    # The display draws the glyph spans, the bitmaps are only needed by LVGL
+    with_bitmaps = "lvgl" in CORE.loaded_integrations
     # create the data array for all glyphs
     for codepoint in codepoints:
         font = point_font_map[codepoint]
         mask = font.font.getmask(codepoint, mode=mode)
         offset_x, offset_y = font.font.getoffset(codepoint)
         width, height = mask.size
-        glyph_data = [0] * ((height * width * bpp + 7) // 8)
-        pos = 0
-        for y in range(height):
-            for x in range(width):
-                pixel = mask.getpixel((x, y)) // scale
-                for bit_num in range(bpp):
-                    if pixel & (1 << (bpp - bit_num - 1)):
-                        glyph_data[pos // 8] |= 0x80 >> (pos % 8)
-                    pos += 1
-        glyph_args[codepoint] = GlyphInfo(len(data), offset_x, offset_y, width, height)
-        data += glyph_data
+        rows = [
+            [min(mask.getpixel((x, y)) // scale, max_value) for x in range(width)]
+            for y in range(height)
+        ]
+        data_len = None
+        if with_bitmaps:
+            glyph_data = [0] * ((height * width * bpp + 7) // 8)
+            pos = 0
+            for row in rows:
+                for pixel in row:
+                    for bit_num in range(bpp):
+                        if pixel & (1 << (bpp - bit_num - 1)):
+                            glyph_data[pos // 8] |= 0x80 >> (pos % 8)
+                        pos += 1
+            data_len = len(data)
+            data += glyph_data
+        spans_pos = len(data)
+        data += encode_glyph_spans(rows, max_value)
+        glyph_args[codepoint] = GlyphInfo(
+            data_len, spans_pos, offset_x, offset_y, width, height
+        )
 
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
@@ -609,8 +699,18 @@ async def to_code(config):
                 ),
                 (
                     "data",
+                    (
+                        cg.nullptr
+                        if glyph_args[codepoint].data_len is None
+                        else cg.RawExpression(
+                            f"{str(prog_arr)} + {str(glyph_args[codepoint].data_len)}"
+                        )
+                    ),
+                ),
+                (
+                    "spans",
                     cg.RawExpression(
-                        f"{str(prog_arr)} + {str(glyph_args[codepoint].data_len)}"
+                        f"{str(prog_arr)} + {str(glyph_args[codepoint].spans_pos)}"
                     ),
                 ),
                 ("offset_x", glyph_args[codepoint].offset_x),
@@ -1,5 +1,7 @@
 #include "font.h"
 
+#include <algorithm>
+
 #include "esphome/core/color.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -9,6 +11,20 @@ namespace font {
 
 static const char *const TAG = "font";
 
+// Glyph span encoding, generated by encode_glyph_spans() in __init__.py. Each span starts with a byte that has its
+// kind in the upper two bits and its length minus one in the lower six.
+static const uint8_t SPAN_KIND_MASK = 0xC0;
+static const uint8_t SPAN_LENGTH_MASK = 0x3F;
+static const uint8_t SPAN_SKIP = 0x00;
+static const uint8_t SPAN_SOLID = 0x40;
+/// Followed by the value of each pixel.
+static const uint8_t SPAN_SHADED = 0x80;
+/// A skip of up to 7 pixels (bits 3-5) followed by up to 8 solid pixels (bits 0-2, minus one).
+static const uint8_t SPAN_SKIP_SOLID = 0xC0;
+/// Shares its kind with SPAN_SKIP_SOLID, which never skips nothing.
+static const uint8_t SPAN_END_ROW = 0xC0;
+static const int SPAN_MAX_LENGTH = 64;
+
 const uint8_t *Glyph::get_char() const { return this->glyph_data_->a_char; }
 // Compare the char at the string position with this char.
 // Return true if this char is less than or equal the other.
@@ -48,10 +64,21 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
 Font::Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t bpp)
     : baseline_(baseline), height_(height), bpp_(bpp) {
   glyphs_.reserve(data_nr);
-  for (int i = 0; i < data_nr; ++i)
+  std::fill_n(this->ascii_glyphs_, FONT_ASCII_COUNT, -1);
+  for (int i = 0; i < data_nr; ++i) {
     glyphs_.emplace_back(&data[i]);
+    const uint8_t *a_char = data[i].a_char;
+    if (a_char[0] >= FONT_ASCII_FIRST && a_char[0] < FONT_ASCII_FIRST + FONT_ASCII_COUNT && a_char[1] == '\0')
+      this->ascii_glyphs_[a_char[0] - FONT_ASCII_FIRST] = i;
+  }
 }
 int Font::match_next_glyph(const uint8_t *str, int *match_length) {
+  // glyphs are single characters, so an ASCII character can only match the glyph for exactly that character
+  if (str[0] >= FONT_ASCII_FIRST && str[0] < FONT_ASCII_FIRST + FONT_ASCII_COUNT) {
+    const int glyph_n = this->ascii_glyphs_[str[0] - FONT_ASCII_FIRST];
+    *match_length = glyph_n < 0 ? 0 : 1;
+    return glyph_n;
+  }
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -103,7 +130,9 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
 void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text, Color background) {
   int i = 0;
   int x_at = x_start;
-  int scan_x1, scan_y1, scan_width, scan_height;
+  // looked up on the first anti-aliased pixel
+  const Color *shades = nullptr;
+  Color colors[SPAN_MAX_LENGTH];
   while (text[i] != '\0') {
     int match_length;
     int glyph_n = this->match_next_glyph((const uint8_t *) text + i, &match_length);
@@ -120,50 +149,69 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
       continue;
     }
 
-    const Glyph &glyph = this->get_glyphs()[glyph_n];
-    glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
-
-    const uint8_t *data = glyph.glyph_data_->data;
-    const int max_x = x_at + scan_x1 + scan_width;
-    const int max_y = y_start + scan_y1 + scan_height;
-
-    uint8_t bitmask = 0;
-    uint8_t pixel_data = 0;
-    uint8_t bpp_max = (1 << this->bpp_) - 1;
-    auto diff_r = (float) color.r - (float) background.r;
-    auto diff_g = (float) color.g - (float) background.g;
-    auto diff_b = (float) color.b - (float) background.b;
-    auto b_r = (float) background.r;
-    auto b_g = (float) background.g;
-    auto b_b = (float) background.g;
-    for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
-      for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
-        uint8_t pixel = 0;
-        for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
-          if (bitmask == 0) {
-            pixel_data = progmem_read_byte(data++);
-            bitmask = 0x80;
+    const GlyphData *glyph_data = this->glyphs_[glyph_n].glyph_data_;
+    const uint8_t *spans = glyph_data->spans;
+    const int row_x = x_at + glyph_data->offset_x;
+    int glyph_x = row_x;
+    int glyph_y = y_start + glyph_data->offset_y;
+    for (int row = 0; row != glyph_data->height;) {
+      const uint8_t span = progmem_read_byte(spans++);
+      const int length = (span & SPAN_LENGTH_MASK) + 1;
+      switch (span & SPAN_KIND_MASK) {
+        case SPAN_SKIP:
+          glyph_x += length;
+          break;
+        case SPAN_SOLID:
+          display->fill_span(glyph_x, glyph_y, length, color);
+          glyph_x += length;
+          break;
+        case SPAN_SHADED:
+          if (shades == nullptr)
+            shades = this->get_shades_(color, background);
+          for (int n = 0; n != length; n++)
+            colors[n] = shades[progmem_read_byte(spans++)];
+          display->blit_span(glyph_x, glyph_y, length, colors);
+          glyph_x += length;
+          break;
+        case SPAN_SKIP_SOLID:
+        default:
+          if (span == SPAN_END_ROW) {
+            glyph_x = row_x;
+            glyph_y++;
+            row++;
+          } else {
+            const int solid = (span & 0x07) + 1;
+            glyph_x += (span >> 3) & 0x07;
+            display->fill_span(glyph_x, glyph_y, solid, color);
+            glyph_x += solid;
           }
-          pixel <<= 1;
-          if ((pixel_data & bitmask) != 0)
-            pixel |= 1;
-          bitmask >>= 1;
-        }
-        if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
-          auto on = (float) pixel / (float) bpp_max;
-          auto blended =
-              Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g), (uint8_t) (diff_b * on + b_b));
-          display->draw_pixel_at(glyph_x, glyph_y, blended);
-        }
+          break;
       }
     }
-    x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
+    x_at += glyph_data->width + glyph_data->offset_x;
 
     i += match_length;
   }
 }
+const Color *Font::get_shades_(Color color, Color background) {
+  GlyphShades *begin = this->shade_cache_;
+  GlyphShades *end = begin + FONT_SHADE_CACHE_SIZE;
+  GlyphShades *entry = std::find_if(begin, end, [&](GlyphShades &shades) {
+    return !shades.shades.empty() && shades.color == color && shades.background == background;
+  });
+  if (entry == end) {
+    // replace the least recently used pair
+    entry = end - 1;
+    entry->color = color;
+    entry->background = background;
+    const int max_value = (1 << this->bpp_) - 1;
+    entry->shades.resize(max_value + 1);
+    for (int value = 0; value <= max_value; value++)
+      entry->shades[value] = background.gradient(color, value * 255 / max_value);
+  }
+  std::rotate(begin, entry, entry + 1);
+  return begin->shades.data();
+}
 #endif
 
 }  // namespace font
@@ -12,9 +12,19 @@ namespace font {
 
 class Font;
 
+/// First character of the printable ASCII range that is looked up directly instead of searched.
+static const uint8_t FONT_ASCII_FIRST = 0x20;
+/// Number of characters in the printable ASCII range.
+static const uint8_t FONT_ASCII_COUNT = 0x5F;
+/// Color pairs that blended shades of anti-aliased glyphs are kept for.
+static const size_t FONT_SHADE_CACHE_SIZE = 2;
+
 struct GlyphData {
   const uint8_t *a_char;
+  /// Packed bitmap of the glyph for LVGL, nullptr if LVGL isn't configured.
   const uint8_t *data;
+  /// The pixels of the glyph as spans per row, as drawn by Font::print().
+  const uint8_t *spans;
   int offset_x;
   int offset_y;
   int width;
@@ -69,7 +79,21 @@ class Font
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+  /// Colors of an anti-aliased glyph pixel blended over a background, indexed by the pixel value.
+  struct GlyphShades {
+    Color color;
+    Color background;
+    std::vector<Color> shades;
+  };
+
+  /// Get the blended colors for a pair of colors, recently used pairs are kept.
+  const Color *get_shades_(Color color, Color background);
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
+  /// Glyph index of each printable ASCII character, -1 if the font doesn't have it.
+  int16_t ascii_glyphs_[FONT_ASCII_COUNT];
+  /// Most recently used first.
+  GlyphShades shade_cache_[FONT_SHADE_CACHE_SIZE];
   int baseline_;
   int height_;
   uint8_t bpp_;  // bits per pixel
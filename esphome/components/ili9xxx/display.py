@@ -86,6 +86,7 @@ COLOR_ORDERS = {
 
 COLOR_PALETTE = cv.one_of("NONE", "GRAYSCALE", "IMAGE_ADAPTIVE")
 
+CONF_ASYNC_FLUSH = "async_flush"
 CONF_LED_PIN = "led_pin"
 CONF_COLOR_PALETTE_IMAGES = "color_palette_images"
 CONF_INVERT_DISPLAY = "invert_display"
@@ -188,6 +189,9 @@ CONFIG_SCHEMA = cv.All(
                 }
             ),
             cv.Optional(CONF_INIT_SEQUENCE): cv.ensure_list(map_sequence),
+            cv.SplitDefault(CONF_ASYNC_FLUSH, esp32_idf=False): cv.All(
+                cv.only_with_esp_idf, cv.boolean
+            ),
         }
     )
     .extend(cv.polling_component_schema("1s"))
@@ -292,3 +296,5 @@ async def to_code(config):
         cg.add(var.set_palette(prog_arr))
 
     cg.add(var.invert_colors(config[CONF_INVERT_COLORS]))
+    if config.get(CONF_ASYNC_FLUSH):
+        cg.add(var.set_async_flush(True))
@@ -57,10 +57,22 @@ void ILI9XXXDisplay::setup() {
 
   this->set_madctl();
   this->command(this->pre_invertcolors_ ? ILI9XXX_INVON : ILI9XXX_INVOFF);
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+
+  if (this->async_flush_) {
+    // internal memory, so the DMA can read it
+    RAMAllocator<uint8_t> allocator(RAMAllocator<uint8_t>::ALLOC_INTERNAL);
+    for (auto &buffer : this->async_buffers_)
+      buffer = allocator.allocate(ILI9XXX_ASYNC_BUFFER_SIZE);
+    if (this->async_buffers_[0] == nullptr || this->async_buffers_[1] == nullptr) {
+      ESP_LOGW(TAG, "Could not allocate flush buffers, flushing synchronously");
+      for (auto &buffer : this->async_buffers_) {
+        if (buffer != nullptr)
+          allocator.deallocate(buffer, ILI9XXX_ASYNC_BUFFER_SIZE);
+        buffer = nullptr;
+      }
+      this->async_flush_ = false;
+    }
+  }
 }
 
 void ILI9XXXDisplay::alloc_buffer_() {
@@ -109,6 +121,7 @@ void ILI9XXXDisplay::dump_config() {
     ESP_LOGCONFIG(TAG, "  18-Bit Mode: YES");
   }
   ESP_LOGCONFIG(TAG, "  Data rate: %dMHz", (unsigned) (this->data_rate_ / 1000000));
+  ESP_LOGCONFIG(TAG, "  Async flush: %s", YESNO(this->async_flush_));
 
   LOG_PIN("  Reset Pin: ", this->reset_pin_);
   LOG_PIN("  CS Pin: ", this->cs_);
@@ -131,35 +144,22 @@ float ILI9XXXDisplay::get_setup_priority() const { return setup_priority::HARDWA
 void ILI9XXXDisplay::fill(Color color) {
   if (!this->check_buffer_())
     return;
-  uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  uint8_t pixel[2];
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
-      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      pixel[0] = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
       break;
-    case BITS_16:
-      new_color = display::ColorUtil::color_to_565(color);
-      {
-        const uint32_t buffer_length_16_bits = this->get_buffer_length_() * 2;
-        if (((uint8_t) (new_color >> 8)) == ((uint8_t) new_color)) {
-          // Upper and lower is equal can use quicker memset operation. Takes ~20ms.
-          memset(this->buffer_, (uint8_t) new_color, buffer_length_16_bits);
-        } else {
-          for (uint32_t i = 0; i < buffer_length_16_bits; i = i + 2) {
-            this->buffer_[i] = (uint8_t) (new_color >> 8);
-            this->buffer_[i + 1] = (uint8_t) new_color;
-          }
-        }
-      }
+    case BITS_16: {
+      const uint16_t new_color = display::ColorUtil::color_to_565(color);
+      put16_be(pixel, new_color);
+      this->fill_buffer_(pixel, 2);
       return;
+    }
     default:
-      new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      pixel[0] = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
       break;
   }
-  memset(this->buffer_, (uint8_t) new_color, this->get_buffer_length_());
+  this->fill_buffer_(pixel, 1);
 }
 
 void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color) {
@@ -194,16 +194,48 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     this->buffer_[pos] = new_color;
     updated = true;
   }
-  if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    if (x < this->x_low_)
-      this->x_low_ = x;
-    if (y < this->y_low_)
-      this->y_low_ = y;
-    if (x > this->x_high_)
-      this->x_high_ = x;
-    if (y > this->y_high_)
-      this->y_high_ = y;
+  if (updated)
+    this->dirty_regions_.mark(x, y);
+}
+
+void HOT ILI9XXXDisplay::fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) {
+  if (!this->check_buffer_())
+    return;
+  uint8_t pixel[2];
+  switch (this->buffer_color_mode_) {
+    case BITS_8_INDEXED:
+      pixel[0] = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      break;
+    case BITS_16:
+      put16_be(pixel, display::ColorUtil::color_to_565(color));
+      this->fill_buffer_span_(x, y, step_x, step_y, count, pixel, 2);
+      return;
+    default:
+      pixel[0] = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      break;
+  }
+  this->fill_buffer_span_(x, y, step_x, step_y, count, pixel, 1);
+}
+
+void HOT ILI9XXXDisplay::blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count,
+                                                     const Color *colors) {
+  if (!this->check_buffer_())
+    return;
+  switch (this->buffer_color_mode_) {
+    case BITS_8_INDEXED:
+      this->blit_buffer_span_(x, y, step_x, step_y, count, colors, 1, [this](Color color) {
+        return display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      });
+      break;
+    case BITS_16:
+      this->blit_buffer_span_(x, y, step_x, step_y, count, colors, 2,
+                              [](Color color) { return display::ColorUtil::color_to_565(color); });
+      break;
+    default:
+      this->blit_buffer_span_(x, y, step_x, step_y, count, colors, 1, [](Color color) {
+        return display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      });
+      break;
   }
 }
 
@@ -221,41 +253,98 @@ void ILI9XXXDisplay::update() {
   this->display_();
 }
 
+void ILI9XXXDisplay::loop() {
+  if (this->flushing_)
+    this->continue_flush_(false);
+}
+
 void ILI9XXXDisplay::display_() {
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
+  // the regions of the last update go out first
+  this->finish_flush_();
+
+  size_t mhz = this->data_rate_ / 1000000;
+  // setting the address window takes 11 separate writes, counted as the pixels that could be sent in that time
+  const uint32_t rect_cost = 11 * SPI_SETUP_US * mhz / 16;
+  if (this->async_flush_) {
+    this->flush_count_ = this->dirty_regions_.take(this->flush_rects_, ILI9XXX_MAX_FLUSH_RECTS, rect_cost);
+    if (this->flush_count_ == 0)
+      return;
+    this->flush_rect_ = 0;
+    this->flush_pixel_ = 0;
+    this->flush_start_ = millis();
+    this->flushing_ = true;
+    // keep the steps of the flush close together
+    this->high_freq_.start();
+    this->continue_flush_(false);
     return;
   }
 
-  // we will only update the changed rows to the display
-  size_t const w = this->x_high_ - this->x_low_ + 1;
-  size_t const h = this->y_high_ - this->y_low_ + 1;
+  display::Rect rects[ILI9XXX_MAX_FLUSH_RECTS];
+  size_t count = this->dirty_regions_.take(rects, ILI9XXX_MAX_FLUSH_RECTS, rect_cost);
+  if (count == 0)
+    return;
+
+  auto now = millis();
+  for (size_t i = 0; i != count; i++)
+    this->display_rect_(rects[i]);
+  ESP_LOGV(TAG, "Data write of %zu regions took %dms", count, (unsigned) (millis() - now));
+}
+
+void ILI9XXXDisplay::display_rect_(const display::Rect &rect) {
+  size_t const w = rect.w;
+  size_t const h = rect.h;
 
   size_t mhz = this->data_rate_ / 1000000;
-  // estimate time for a single write
+  // estimate time for a single write of whole rows
   size_t sw_time = this->width_ * h * 16 / mhz + this->width_ * h * 2 / SPI_MAX_BLOCK_SIZE * SPI_SETUP_US * 2;
-  // estimate time for multiple writes
-  size_t mw_time = (w * h * 16) / mhz + w * h * 2 / ILI9XXX_TRANSFER_BUFFER_SIZE * SPI_SETUP_US;
+  // estimate time for one write per row
+  size_t mw_time = (w * h * 16) / mhz + h * SPI_SETUP_US;
   ESP_LOGV(TAG,
-           "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
-           "height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, this->buffer_color_mode_,
-           this->is_18bitdisplay_, sw_time, mw_time);
-  auto now = millis();
-  if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_ && sw_time < mw_time) {
+           "Start display(x:%d, y:%d, width:%zu, height:%zu, mode=%d, 18bit=%d, sw_time=%zuus, mw_time=%zuus)",
+           rect.x, rect.y, w, h, this->buffer_color_mode_, this->is_18bitdisplay_, sw_time, mw_time);
+  if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_) {
     // 16 bit mode maps directly to display format
-    ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
-    set_addr_window_(0, this->y_low_, this->width_ - 1, this->y_high_);
-    this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
+    if (w == size_t(this->width_) || sw_time < mw_time) {
+      ESP_LOGV(TAG, "Doing single write of %zu bytes", this->width_ * h * 2);
+      this->set_addr_window_(0, rect.y, this->width_ - 1, rect.y2() - 1);
+      this->write_array(this->buffer_ + rect.y * this->width_ * 2, h * this->width_ * 2);
+    } else {
+      this->set_addr_window_(rect.x, rect.y, rect.x2() - 1, rect.y2() - 1);
+      for (int y = rect.y; y != rect.y2(); y++)
+        this->write_array(this->buffer_ + (y * this->width_ + rect.x) * 2, w * 2);
+    }
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
     uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
-    size_t rem = h * w;  // remaining number of pixels to write
-    set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
-    size_t idx = 0;    // index into transfer_buffer
+    this->set_addr_window_(rect.x, rect.y, rect.x2() - 1, rect.y2() - 1);
     size_t pixel = 0;  // pixel number offset
-    size_t pos = this->y_low_ * this->width_ + this->x_low_;
-    while (rem-- != 0) {
+    while (pixel != w * h) {
+      this->write_array(transfer_buffer, this->copy_pixels_(transfer_buffer, sizeof(transfer_buffer), rect, pixel));
+      App.feed_wdt();
+    }
+  }
+  this->end_data_();
+}
+
+// Convert the pixels of rect from number pixel on to what is sent to the display, as many as fit in size bytes.
+// Returns the number of bytes written to dst and advances pixel past the converted ones.
+size_t ILI9XXXDisplay::copy_pixels_(uint8_t *dst, size_t size, const display::Rect &rect, size_t &pixel) {
+  size_t const w = rect.w;
+  size_t const total = w * rect.h;
+  size_t const bytes_per_pixel = this->is_18bitdisplay_ ? 3 : 2;
+  size_t idx = 0;  // index into dst
+  while (pixel != total && idx + bytes_per_pixel <= size) {
+    size_t const x = pixel % w;
+    size_t pos = (rect.y + pixel / w) * this->width_ + rect.x + x;
+    // the rest of the row, or what fits
+    size_t const count = std::min(w - x, (size - idx) / bytes_per_pixel);
+    pixel += count;
+    if (this->buffer_color_mode_ == BITS_16 && !this->is_18bitdisplay_) {
+      memcpy(dst + idx, this->buffer_ + pos * 2, count * 2);
+      idx += count * 2;
+      continue;
+    }
+    for (size_t i = 0; i != count; i++) {
       uint16_t color_val;
       switch (this->buffer_color_mode_) {
         case BITS_8:
@@ -271,36 +360,67 @@ void ILI9XXXDisplay::display_() {
           break;
       }
       if (this->is_18bitdisplay_) {
-        transfer_buffer[idx++] = (uint8_t) ((color_val & 0xF800) >> 8);  // Blue
-        transfer_buffer[idx++] = (uint8_t) ((color_val & 0x7E0) >> 3);   // Green
-        transfer_buffer[idx++] = (uint8_t) (color_val << 3);             // Red
+        dst[idx++] = (uint8_t) ((color_val & 0xF800) >> 8);  // Blue
+        dst[idx++] = (uint8_t) ((color_val & 0x7E0) >> 3);   // Green
+        dst[idx++] = (uint8_t) (color_val << 3);             // Red
       } else {
-        put16_be(transfer_buffer + idx, color_val);
+        put16_be(dst + idx, color_val);
         idx += 2;
       }
-      if (idx == sizeof(transfer_buffer)) {
-        this->write_array(transfer_buffer, idx);
-        idx = 0;
-        App.feed_wdt();
-      }
-      // end of line? Skip to the next.
-      if (++pixel == w) {
-        pixel = 0;
-        pos += this->width_ - w;
-      }
     }
-    // flush any balance.
-    if (idx != 0) {
-      this->write_array(transfer_buffer, idx);
+  }
+  return idx;
+}
+
+// Send the next part of the regions being flushed, filling one partial buffer while the other one is sent. Each step
+// takes about ILI9XXX_FLUSH_STEP_US and releases the bus before returning, so the main loop and other devices on the
+// bus (like a touchscreen) get their turn between the steps. With wait, returns only once everything was sent.
+void ILI9XXXDisplay::continue_flush_(bool wait) {
+  const uint32_t start = micros();
+  size_t const bytes_per_pixel = this->is_18bitdisplay_ ? 3 : 2;
+  while (this->flush_rect_ != this->flush_count_) {
+    const display::Rect &rect = this->flush_rects_[this->flush_rect_];
+    size_t const x = this->flush_pixel_ % rect.w;
+    if (x == 0 && !wait && micros() - start >= ILI9XXX_FLUSH_STEP_US)
+      break;
+    if (!this->window_open_) {
+      // the window starts at the first row of the region that wasn't sent yet
+      this->set_addr_window_(rect.x, rect.y + this->flush_pixel_ / rect.w, rect.x2() - 1, rect.y2() - 1);
+      this->window_open_ = true;
+    }
+    // one partial buffer is filled while the other one is sent
+    if (this->get_queued_writes() == 2)
+      this->wait_queued_writes(1);
+    // whole rows, or the rest of a row that is longer than the buffer, so a step can end at the end of a row
+    size_t const row_size = rect.w * bytes_per_pixel;
+    size_t size = ILI9XXX_ASYNC_BUFFER_SIZE;
+    if (x != 0 || row_size > size) {
+      size = std::min(size, (rect.w - x) * bytes_per_pixel);
+    } else {
+      size = size / row_size * row_size;
     }
+    uint8_t *buffer = this->async_buffers_[this->async_index_];
+    this->async_index_ ^= 1;
+    this->queue_write_array(buffer, this->copy_pixels_(buffer, size, rect, this->flush_pixel_));
+    if (this->flush_pixel_ == size_t(rect.w) * rect.h) {
+      // the address window can only be changed once the data of this region was sent
+      this->end_data_();
+      this->window_open_ = false;
+      this->flush_rect_++;
+      this->flush_pixel_ = 0;
+    }
+    App.feed_wdt();
   }
-  this->end_data_();
-  ESP_LOGV(TAG, "Data write took %dms", (unsigned) (millis() - now));
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
+  if (this->window_open_) {
+    // waits for the queued writes and releases the bus, the next step opens the window again
+    this->end_data_();
+    this->window_open_ = false;
+  }
+  if (this->flush_rect_ != this->flush_count_)
+    return;
+  this->flushing_ = false;
+  this->high_freq_.stop();
+  ESP_LOGV(TAG, "Data write of %zu regions took %ums", this->flush_count_, (unsigned) (millis() - this->flush_start_));
 }
 
 // note that this bypasses the buffer and writes directly to the display.
@@ -309,6 +429,7 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
                                     int x_offset, int y_offset, int x_pad) {
   if (w <= 0 || h <= 0)
     return;
+  this->finish_flush_();
   // if color mapping or software rotation is required, hand this off to the parent implementation. This will
   // do color conversion pixel-by-pixel into the buffer and draw it later. If this is happening the user has not
   // configured the renderer well.
@@ -451,6 +572,7 @@ void ILI9XXXDisplay::set_addr_window_(uint16_t x1, uint16_t y1, uint16_t x2, uin
 void ILI9XXXDisplay::invert_colors(bool invert) {
   this->pre_invertcolors_ = invert;
   if (is_ready()) {
+    this->finish_flush_();
     this->command(invert ? ILI9XXX_INVON : ILI9XXX_INVOFF);
   }
 }
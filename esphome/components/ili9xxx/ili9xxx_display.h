@@ -2,6 +2,7 @@
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display_buffer.h"
 #include "esphome/components/display/display_color_utils.h"
+#include "esphome/core/helpers.h"
 #include "ili9xxx_defines.h"
 #include "ili9xxx_init.h"
 
@@ -10,6 +11,9 @@ namespace ili9xxx {
 
 static const char *const TAG = "ili9xxx";
 const size_t ILI9XXX_TRANSFER_BUFFER_SIZE = 126;  // ensure this is divisible by 6
+const size_t ILI9XXX_MAX_FLUSH_RECTS = 8;          // most separate regions sent per update
+const size_t ILI9XXX_ASYNC_BUFFER_SIZE = 4092;     // one DMA transfer, also divisible by 6
+const uint32_t ILI9XXX_FLUSH_STEP_US = 8000;       // time an async flush keeps the bus per loop() call
 
 enum ILI9XXXColorMode {
   BITS_8 = 0x08,
@@ -82,14 +86,20 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   void set_mirror_x(bool mirror_x) { this->mirror_x_ = mirror_x; }
   void set_mirror_y(bool mirror_y) { this->mirror_y_ = mirror_y; }
   void set_pixel_mode(PixelMode mode) { this->pixel_mode_ = mode; }
+  /// Send the buffer with queued DMA writes from two partial buffers, spread over the following loop() calls.
+  void set_async_flush(bool async_flush) { this->async_flush_ = async_flush; }
 
   void update() override;
+  void loop() override;
 
   void fill(Color color) override;
 
   void dump_config() override;
   void setup() override;
-  void on_shutdown() override { this->command(ILI9XXX_SLPIN); }
+  void on_shutdown() override {
+    this->finish_flush_();
+    this->command(ILI9XXX_SLPIN);
+  }
 
   display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_COLOR; }
   void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
@@ -105,10 +115,19 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   }
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) override;
+  void blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors) override;
   void setup_pins_();
 
   virtual void set_madctl();
   void display_();
+  void display_rect_(const display::Rect &rect);
+  size_t copy_pixels_(uint8_t *dst, size_t size, const display::Rect &rect, size_t &pixel);
+  void continue_flush_(bool wait);
+  void finish_flush_() {
+    if (this->flushing_)
+      this->continue_flush_(true);
+  }
   void init_lcd_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t x2, uint16_t y2);
   void reset_();
@@ -119,10 +138,6 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   int16_t height_{0};  ///< Display height as modified by current rotation
   int16_t offset_x_{0};
   int16_t offset_y_{0};
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
   const uint8_t *palette_{};
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
@@ -150,6 +165,21 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   bool swap_xy_{};
   bool mirror_x_{};
   bool mirror_y_{};
+
+  bool async_flush_{false};
+  /// An async flush is in progress, the regions still to send are in flush_rects_.
+  bool flushing_{false};
+  /// The address window was set and the data transaction is open, only during a step of the flush.
+  bool window_open_{false};
+  uint8_t *async_buffers_[2]{};
+  uint8_t async_index_{0};
+  display::Rect flush_rects_[ILI9XXX_MAX_FLUSH_RECTS];
+  size_t flush_count_{0};
+  size_t flush_rect_{0};
+  /// Pixels of the current region that were queued already.
+  size_t flush_pixel_{0};
+  uint32_t flush_start_{0};
+  HighFrequencyLoopRequester high_freq_;
 };
 
 //-----------   M5Stack display --------------
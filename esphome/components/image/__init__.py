@@ -45,7 +45,17 @@ IMAGE_TYPE = {
     "RGBA": ImageType.IMAGE_TYPE_RGBA,
 }
 
+ImageCompression = image_ns.enum("ImageCompression")
+IMAGE_COMPRESSION = {
+    "NONE": ImageCompression.IMAGE_COMPRESSION_NONE,
+    "RLE": ImageCompression.IMAGE_COMPRESSION_RLE,
+}
+
 CONF_USE_TRANSPARENCY = "use_transparency"
+CONF_COMPRESSION = "compression"
+
+# Longest run or literal stretch that fits in an RLE header byte
+RLE_MAX_LENGTH = 128
 
 # If the MDI file cannot be downloaded within this time, abort.
 IMAGE_DOWNLOAD_TIMEOUT = 30  # seconds
@@ -227,6 +237,9 @@ IMAGE_SCHEMA = cv.Schema(
             cv.Optional(CONF_DITHER, default="NONE"): cv.one_of(
                 "NONE", "FLOYDSTEINBERG", upper=True
             ),
+            cv.Optional(CONF_COMPRESSION, default="NONE"): cv.enum(
+                IMAGE_COMPRESSION, upper=True
+            ),
             cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
         },
         validate_cross_dependencies,
@@ -236,6 +249,50 @@ IMAGE_SCHEMA = cv.Schema(
 CONFIG_SCHEMA = cv.All(font.validate_pillow_installed, IMAGE_SCHEMA)
 
 
+def encode_rle(data: list[int], stride: int, unit: int) -> list[int]:
+    """Run-length encode every row of stride bytes on its own, in units of one pixel.
+
+    A header byte with the top bit set repeats the following unit (header & 0x7F) + 1
+    times, otherwise header + 1 units follow as they are.
+    """
+    # Short repeats are cheaper to keep as literals when pixels are single bytes
+    min_run = 3 if unit == 1 else 2
+    encoded = []
+    for row_start in range(0, len(data), stride):
+        units = [
+            tuple(data[pos : pos + unit])
+            for pos in range(row_start, row_start + stride, unit)
+        ]
+        literals = []
+
+        def flush_literals():
+            for start in range(0, len(literals), RLE_MAX_LENGTH):
+                chunk = literals[start : start + RLE_MAX_LENGTH]
+                encoded.append(len(chunk) - 1)
+                for value in chunk:
+                    encoded.extend(value)
+            literals.clear()
+
+        pos = 0
+        while pos < len(units):
+            run = 1
+            while (
+                pos + run < len(units)
+                and run < RLE_MAX_LENGTH
+                and units[pos + run] == units[pos]
+            ):
+                run += 1
+            if run >= min_run:
+                flush_literals()
+                encoded.append(0x80 | (run - 1))
+                encoded.extend(units[pos])
+            else:
+                literals.extend(units[pos : pos + run])
+            pos += run
+        flush_literals()
+    return encoded
+
+
 def load_svg_image(file: bytes, resize: tuple[int, int]):
     # Local imports only to allow "validate_pillow_installed" to run *before* importing it
     # cairosvg is only needed in case of SVG images; adding it
@@ -400,9 +457,32 @@ async def to_code(config):
             f"Image f{config[CONF_ID]} has an unsupported type: {config[CONF_TYPE]}."
         )
 
+    compression = config[CONF_COMPRESSION]
+    if compression == "RLE":
+        stride = len(data) // height
+        unit = max(len(data) // (height * width), 1)
+        encoded = encode_rle(data, stride, unit)
+        if len(encoded) < len(data):
+            _LOGGER.debug(
+                "%s: RLE compressed %d to %d bytes",
+                config[CONF_ID],
+                len(data),
+                len(encoded),
+            )
+            data = encoded
+        else:
+            # Photos and noise don't have runs, drawing them uncompressed is faster
+            _LOGGER.warning(
+                'The image "%s" does not get smaller with RLE compression, storing it uncompressed.',
+                path,
+            )
+            compression = "NONE"
+
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     var = cg.new_Pvariable(
         config[CONF_ID], prog_arr, width, height, IMAGE_TYPE[config[CONF_TYPE]]
     )
     cg.add(var.set_transparency(transparent))
+    if compression != "NONE":
+        cg.add(var.set_compression(IMAGE_COMPRESSION[compression]))
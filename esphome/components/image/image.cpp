@@ -1,69 +1,191 @@
 #include "image.h"
 
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
+#include <memory>
 
 namespace esphome {
 namespace image {
 
+// Colors collected on the stack before they are handed to the display as one span.
+static const int IMAGE_SPAN_PIXELS = 32;
+
+// Pixel decoders for a row, either in the image data itself or decompressed into RAM.
+static bool binary_pixel(const uint8_t *line, int x) {
+  return progmem_read_byte(line + x / 8u) & (0x80 >> (x % 8u));
+}
+static Color grayscale_pixel(const uint8_t *line, int x, bool transparent) {
+  const uint8_t gray = progmem_read_byte(line + x);
+  return Color(gray, gray, gray, (gray == 1 && transparent) ? 0 : 0xFF);
+}
+static Color rgb24_pixel(const uint8_t *line, int x, bool transparent) {
+  const uint8_t *pos = line + x * 3;
+  const uint8_t r = progmem_read_byte(pos + 0);
+  const uint8_t g = progmem_read_byte(pos + 1);
+  const uint8_t b = progmem_read_byte(pos + 2);
+  // (0, 0, 1) has been defined as transparent color for non-alpha images.
+  const bool clear = b == 1 && r == 0 && g == 0 && transparent;
+  return Color(r, g, b, clear ? 0 : 0xFF);
+}
+static Color rgb565_pixel(const uint8_t *line, int x, bool transparent) {
+  const uint8_t *pos = line + x * (transparent ? 3 : 2);
+  const uint16_t rgb565 = encode_uint16(progmem_read_byte(pos), progmem_read_byte(pos + 1));
+  const auto r = (rgb565 & 0xF800) >> 11;
+  const auto g = (rgb565 & 0x07E0) >> 5;
+  const auto b = rgb565 & 0x001F;
+  return Color((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2),
+               transparent ? progmem_read_byte(pos + 2) : 0xFF);
+}
+static Color rgba_pixel(const uint8_t *line, int x) {
+  const uint8_t *pos = line + x * 4;
+  return Color(progmem_read_byte(pos + 0), progmem_read_byte(pos + 1), progmem_read_byte(pos + 2),
+               progmem_read_byte(pos + 3));
+}
+
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
-  switch (type_) {
-    case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
-          } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
-          }
-        }
-      }
-      break;
+  // Uncompressed rows are read straight from the image data, compressed ones are decompressed one at a time into RAM.
+  // Every type has its own row loop so the type is only looked at once per row.
+  const bool compressed = this->compression_ != IMAGE_COMPRESSION_NONE;
+  uint8_t *buffer = compressed ? this->get_line_() : nullptr;
+  const uint32_t stride = this->get_width_stride();
+  const uint8_t *data = this->data_start_;
+  const bool transparent = this->transparent_;
+  for (int img_y = 0; img_y < this->height_; img_y++) {
+    const uint8_t *line = data;
+    if (compressed) {
+      data = this->read_row_(data, buffer);
+      line = buffer;
+    } else {
+      data += stride;
+    }
+    switch (this->type_) {
+      case IMAGE_TYPE_BINARY:
+        this->fill_binary_row_(x, y + img_y, display, line, color_on, color_off);
+        break;
+      case IMAGE_TYPE_GRAYSCALE:
+        this->blit_row_(x, y + img_y, display, line,
+                        [transparent](const uint8_t *row, int i) { return grayscale_pixel(row, i, transparent); });
+        break;
+      case IMAGE_TYPE_RGB565:
+        this->blit_row_(x, y + img_y, display, line,
+                        [transparent](const uint8_t *row, int i) { return rgb565_pixel(row, i, transparent); });
+        break;
+      case IMAGE_TYPE_RGB24:
+        this->blit_row_(x, y + img_y, display, line,
+                        [transparent](const uint8_t *row, int i) { return rgb24_pixel(row, i, transparent); });
+        break;
+      case IMAGE_TYPE_RGBA:
+        this->blit_row_(x, y + img_y, display, line, rgba_pixel);
+        break;
     }
-    case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_grayscale_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
-    case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
-    case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb24_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
-    case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgba_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
+  }
+  if (compressed) {
+    // the buffer holds the last row now
+    this->line_data_start_ = this->data_start_;
+    this->line_y_ = this->height_ - 1;
+    this->line_next_ = data;
+  }
+}
+uint8_t *Image::get_line_() const {
+  const uint32_t stride = this->get_width_stride();
+  if (this->line_size_ != stride) {
+    this->line_.reset(new uint8_t[stride]);  // NOLINT
+    this->line_size_ = stride;
+    this->line_data_start_ = nullptr;
+  }
+  return this->line_.get();
+}
+const uint8_t *Image::read_row_(const uint8_t *data, uint8_t *line) const {
+  const uint32_t stride = this->get_width_stride();
+  const uint32_t unit = std::max(this->get_bpp() / 8, 1);
+  uint32_t pos = 0;
+  while (pos < stride) {
+    const uint8_t header = progmem_read_byte(data++);
+    const uint32_t size = std::min(((header & 0x7Fu) + 1) * unit, stride - pos);
+    if (header & 0x80) {
+      for (uint32_t i = 0; i < unit; i++)
+        line[pos + i] = progmem_read_byte(data + i);
+      for (uint32_t i = unit; i < size; i++)
+        line[pos + i] = line[pos + i - unit];
+      data += unit;
+    } else {
+      for (uint32_t i = 0; i < size; i++)
+        line[pos + i] = progmem_read_byte(data + i);
+      data += size;
+    }
+    pos += size;
+  }
+  return data;
+}
+template<typename F> void Image::blit_row_(int x, int y, display::Display *display, const uint8_t *line, F pixel) {
+  Color colors[IMAGE_SPAN_PIXELS];
+  int start = 0;
+  int count = 0;
+  for (int img_x = 0; img_x < this->width_; img_x++) {
+    const Color color = pixel(line, img_x);
+    if (color.w >= 0x80) {
+      if (count == 0)
+        start = img_x;
+      colors[count++] = color;
+      if (count != IMAGE_SPAN_PIXELS)
+        continue;
+    }
+    if (count != 0) {
+      display->blit_span(x + start, y, count, colors);
+      count = 0;
+    }
+  }
+  if (count != 0)
+    display->blit_span(x + start, y, count, colors);
+}
+void Image::fill_binary_row_(int x, int y, display::Display *display, const uint8_t *line, Color color_on,
+                             Color color_off) {
+  int img_x = 0;
+  while (img_x < this->width_) {
+    const bool on = binary_pixel(line, img_x);
+    int end = img_x + 1;
+    while (end < this->width_ && binary_pixel(line, end) == on)
+      end++;
+    if (on) {
+      display->fill_span(x + img_x, y, end - img_x, color_on);
+    } else if (!this->transparent_) {
+      display->fill_span(x + img_x, y, end - img_x, color_off);
+    }
+    img_x = end;
   }
 }
 Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return color_off;
+  if (this->compression_ != IMAGE_COMPRESSION_NONE) {
+    uint8_t *line = this->get_line_();
+    if (this->line_data_start_ != this->data_start_ || this->line_y_ > y) {
+      // rows can only be found by decoding the ones before them, start over
+      this->line_data_start_ = this->data_start_;
+      this->line_y_ = -1;
+      this->line_next_ = this->data_start_;
+    }
+    while (this->line_y_ < y) {
+      this->line_next_ = this->read_row_(this->line_next_, line);
+      this->line_y_++;
+    }
+    switch (this->type_) {
+      case IMAGE_TYPE_BINARY:
+        return binary_pixel(line, x) ? color_on : color_off;
+      case IMAGE_TYPE_GRAYSCALE:
+        return grayscale_pixel(line, x, this->transparent_);
+      case IMAGE_TYPE_RGB565:
+        return rgb565_pixel(line, x, this->transparent_);
+      case IMAGE_TYPE_RGB24:
+        return rgb24_pixel(line, x, this->transparent_);
+      case IMAGE_TYPE_RGBA:
+        return rgba_pixel(line, x);
+      default:
+        return color_off;
+    }
+  }
   switch (this->type_) {
     case IMAGE_TYPE_BINARY:
       return this->get_binary_pixel_(x, y) ? color_on : color_off;
@@ -2,6 +2,8 @@
 #include "esphome/core/color.h"
 #include "esphome/components/display/display.h"
 
+#include <memory>
+
 #ifdef USE_LVGL
 #include "esphome/components/lvgl/lvgl_proxy.h"
 #endif  // USE_LVGL
@@ -17,9 +19,17 @@ enum ImageType {
   IMAGE_TYPE_RGBA = 4,
 };
 
+enum ImageCompression {
+  IMAGE_COMPRESSION_NONE = 0,
+  /// Every row is run-length encoded on its own, in units of one pixel (one byte for binary images). A header byte
+  /// with the top bit set repeats the following unit (header & 0x7F) + 1 times, otherwise header + 1 units follow.
+  IMAGE_COMPRESSION_RLE = 1,
+};
+
 class Image : public display::BaseImage {
  public:
   Image(const uint8_t *data_start, int width, int height, ImageType type);
+  /// Compressed images are decoded up to row \p y for this, unless it is the last row read or comes after it.
   Color get_pixel(int x, int y, Color color_on = display::COLOR_ON, Color color_off = display::COLOR_OFF) const;
   int get_width() const override;
   int get_height() const override;
@@ -49,6 +59,8 @@ class Image : public display::BaseImage {
 
   void set_transparency(bool transparent) { transparent_ = transparent; }
   bool has_transparency() const { return transparent_; }
+  void set_compression(ImageCompression compression) { compression_ = compression; }
+  ImageCompression get_compression() const { return compression_; }
 
 #ifdef USE_LVGL
   lv_img_dsc_t *get_lv_img_dsc();
@@ -60,11 +72,29 @@ class Image : public display::BaseImage {
   Color get_rgb565_pixel_(int x, int y) const;
   Color get_grayscale_pixel_(int x, int y) const;
 
+  /// Decompress the row starting at \p data into \p line (get_width_stride() bytes) and return where the next row
+  /// starts.
+  const uint8_t *read_row_(const uint8_t *data, uint8_t *line) const;
+  /// The buffer compressed rows are decompressed into, allocated on first use and kept for the next draw() or
+  /// get_pixel(). Uncompressed images don't need one.
+  uint8_t *get_line_() const;
+  /// Draw the row \p line (in the image data or in RAM) with spans, \p pixel converts the pixel at a position to a
+  /// color.
+  template<typename F> void blit_row_(int x, int y, display::Display *display, const uint8_t *line, F pixel);
+  void fill_binary_row_(int x, int y, display::Display *display, const uint8_t *line, Color color_on, Color color_off);
+
   int width_;
   int height_;
   ImageType type_;
   const uint8_t *data_start_;
   bool transparent_;
+  ImageCompression compression_{IMAGE_COMPRESSION_NONE};
+  mutable std::unique_ptr<uint8_t[]> line_;
+  mutable uint32_t line_size_{0};
+  /// The image data and row the last row read into line_ came from, and where the row after it starts.
+  mutable const uint8_t *line_data_start_{nullptr};
+  mutable int line_y_{-1};
+  mutable const uint8_t *line_next_{nullptr};
 #ifdef USE_LVGL
   lv_img_dsc_t dsc_{};
 #endif
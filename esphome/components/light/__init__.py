@@ -45,6 +45,7 @@ from .effects import (
     validate_effects,
 )
 from .types import (  # noqa
+    TRANSITION_EASINGS,
     AddressableLight,
     AddressableLightState,
     ColorMode,
@@ -60,6 +61,8 @@ from .types import (  # noqa
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
 
+CONF_TRANSITION_EASING = "transition_easing"
+
 LightRestoreMode = light_ns.enum("LightRestoreMode")
 RESTORE_MODES = {
     "RESTORE_DEFAULT_OFF": LightRestoreMode.LIGHT_RESTORE_DEFAULT_OFF,
@@ -119,6 +122,9 @@ BRIGHTNESS_ONLY_LIGHT_SCHEMA = LIGHT_SCHEMA.extend(
         cv.Optional(
             CONF_FLASH_TRANSITION_LENGTH, default="0s"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_TRANSITION_EASING, default="SMOOTH"): cv.enum(
+            TRANSITION_EASINGS, upper=True
+        ),
         cv.Optional(CONF_EFFECTS): validate_effects(MONOCHROMATIC_EFFECTS),
     }
 )
@@ -184,6 +190,8 @@ async def setup_light_core_(light_var, output_var, config):
         flash_transition_length := config.get(CONF_FLASH_TRANSITION_LENGTH)
     ) is not None:
         cg.add(light_var.set_flash_transition_length(flash_transition_length))
+    if (transition_easing := config.get(CONF_TRANSITION_EASING)) is not None:
+        cg.add(light_var.set_transition_easing(transition_easing))
     if (gamma_correct := config.get(CONF_GAMMA_CORRECT)) is not None:
         cg.add(light_var.set_gamma_correct(gamma_correct))
     effects = await cg.build_registry_list(
@@ -1,4 +1,7 @@
 #include "addressable_light.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -13,8 +16,10 @@ void AddressableLight::call_setup() {
   this->set_interval(5000, [this]() {
     const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
     ESP_LOGVV(TAG, "Addressable Light '%s' (effect_active=%s)", name, YESNO(this->effect_active_));
+    ESP_LOGVV(TAG, "  Writes: %" PRIu32 " full, %" PRIu32 " partial, %" PRIu32 " skipped", this->full_writes_,
+              this->partial_writes_, this->skipped_writes_);
     for (int i = 0; i < this->size(); i++) {
-      auto color = this->get(i);
+      auto color = this->get_view_internal(i);
       ESP_LOGVV(TAG, "  [%2d] Color: R=%3u G=%3u B=%3u W=%3u", i, color.get_red_raw(), color.get_green_raw(),
                 color.get_blue_raw(), color.get_white_raw());
     }
@@ -23,6 +28,95 @@ void AddressableLight::call_setup() {
 #endif
 }
 
+void AddressableLight::fill(int32_t from, int32_t to, const Color &color) {
+  from = std::max(from, int32_t(0));
+  to = std::min(to, this->size());
+  if (from >= to)
+    return;
+  this->mark_dirty(from, to);
+  const PixelBuffer buffer = this->get_pixel_buffer_();
+  if (buffer.data == nullptr) {
+    for (int32_t i = from; i < to; i++)
+      this->get_view_internal(i).set(color);
+    return;
+  }
+
+  const Color corrected = this->correction_.color_correct(color);
+  uint8_t *pixel = buffer.data + from * buffer.stride;
+  for (int32_t i = from; i < to; i++, pixel += buffer.stride) {
+    pixel[buffer.red] = corrected.red;
+    pixel[buffer.green] = corrected.green;
+    pixel[buffer.blue] = corrected.blue;
+    if (buffer.white >= 0)
+      pixel[buffer.white] = corrected.white;
+  }
+}
+
+void AddressableLight::write_span(int32_t from, const Color *colors, int32_t count) {
+  if (from < 0) {
+    colors -= from;
+    count += from;
+    from = 0;
+  }
+  count = std::min(count, this->size() - from);
+  if (count <= 0)
+    return;
+  this->mark_dirty(from, from + count);
+  const PixelBuffer buffer = this->get_pixel_buffer_();
+  if (buffer.data == nullptr) {
+    for (int32_t i = 0; i < count; i++)
+      this->get_view_internal(from + i).set(colors[i]);
+    return;
+  }
+
+  uint8_t *pixel = buffer.data + from * buffer.stride;
+  for (int32_t i = 0; i < count; i++, pixel += buffer.stride) {
+    pixel[buffer.red] = this->correction_.color_correct_red(colors[i].red);
+    pixel[buffer.green] = this->correction_.color_correct_green(colors[i].green);
+    pixel[buffer.blue] = this->correction_.color_correct_blue(colors[i].blue);
+    if (buffer.white >= 0)
+      pixel[buffer.white] = this->correction_.color_correct_white(colors[i].white);
+  }
+}
+
+void AddressableLight::blit(int32_t from, int32_t src_from, int32_t count) {
+  count = std::min({count, this->size() - from, this->size() - src_from});
+  if (from < 0 || src_from < 0 || count <= 0 || from == src_from)
+    return;
+  this->mark_dirty(from, from + count);
+  const PixelBuffer buffer = this->get_pixel_buffer_();
+  if (buffer.data != nullptr) {
+    memmove(buffer.data + from * buffer.stride, buffer.data + src_from * buffer.stride, count * buffer.stride);
+    return;
+  }
+
+  // Go the same way as the copy so no LED is overwritten before it's copied
+  if (src_from > from) {
+    for (int32_t i = 0; i < count; i++)
+      this->get_view_internal(from + i).set(this->get_view_internal(src_from + i).get());
+  } else {
+    for (int32_t i = count - 1; i >= 0; i--)
+      this->get_view_internal(from + i).set(this->get_view_internal(src_from + i).get());
+  }
+}
+
+bool AddressableLight::take_dirty_range_(int32_t &from, int32_t &to) {
+  from = std::max(this->dirty_from_, int32_t(0));
+  to = std::min(this->dirty_to_, this->size());
+  this->dirty_from_ = INT32_MAX;
+  this->dirty_to_ = 0;
+  if (from >= to) {
+    this->skipped_writes_++;
+    return false;
+  }
+  if (from == 0 && to == this->size()) {
+    this->full_writes_++;
+  } else {
+    this->partial_writes_++;
+  }
+  return true;
+}
+
 std::unique_ptr<LightTransformer> AddressableLight::create_default_transition() {
   return make_unique<AddressableLightTransformer>(*this);
 }
@@ -48,6 +142,13 @@ void AddressableLight::update_state(LightState *state) {
   this->schedule_show();
 }
 
+AddressableLightTransformer::~AddressableLightTransformer() {
+  if (this->start_colors_ != nullptr) {
+    RAMAllocator<Color> allocator;
+    allocator.deallocate(this->start_colors_, this->start_colors_size_);
+  }
+}
+
 void AddressableLightTransformer::start() {
   // don't try to transition over running effects.
   if (this->light_.is_effect_active())
@@ -59,22 +160,64 @@ void AddressableLightTransformer::start() {
   // our transition will handle brightness, disable brightness in correction.
   this->light_.correction_.set_local_brightness(255);
   this->target_color_ *= to_uint8_scale(end_values.get_brightness() * end_values.get_state());
+
+  // Keep the current color of every LED, so each one can be interpolated to the target exactly.
+  RAMAllocator<Color> allocator;
+  this->start_colors_size_ = this->light_.size();
+  this->start_colors_ = allocator.allocate(this->start_colors_size_);
+  if (this->start_colors_ == nullptr) {
+    ESP_LOGW(TAG, "Not enough memory for the start colors of the transition, it will be approximated.");
+    return;
+  }
+  for (int32_t i = 0; i < this->start_colors_size_; i++)
+    this->start_colors_[i] = this->light_[i].get();
 }
 
 optional<LightColorValues> AddressableLightTransformer::apply() {
-  float smoothed_progress = LightTransitionTransformer::smoothed_progress(this->get_progress_());
+  const uint32_t weight = ease_q16(this->easing_, this->get_progress_q16_());
 
   // When running an output-buffer modifying effect, don't try to transition individual LEDs, but instead just fade the
   // LightColorValues. write_state() then picks up the change in brightness, and the color change is picked up by the
   // effects which respect it.
   if (this->light_.is_effect_active())
-    return LightColorValues::lerp(this->get_start_values(), this->get_target_values(), smoothed_progress);
+    return LightColorValues::lerp(this->get_start_values(), this->get_target_values(), weight / float(Q16_ONE));
 
   // Use a specialized transition for addressable lights: instead of using a unified transition for
-  // all LEDs, we use the current state of each LED as the start.
+  // all LEDs, we use the state of each LED at the start as the start.
+  if (this->start_colors_ == nullptr || this->start_colors_size_ != this->light_.size()) {
+    this->apply_exponential_(weight / float(Q16_ONE));
+  } else if (weight != this->last_weight_) {
+    this->apply_q16_(weight);
+    this->last_weight_ = weight;
+    this->light_.schedule_show();
+  }
+
+  return {};
+}
+
+void AddressableLightTransformer::apply_q16_(uint32_t weight) {
+  // Interpolated in chunks on the stack, which are then written to the LEDs at once with the correction applied.
+  static const int32_t CHUNK_SIZE = 64;
+  Color colors[CHUNK_SIZE];
+  const uint8_t *target = this->target_color_.raw;
+  const int32_t w = weight;
+  const int32_t half = Q16_ONE / 2;
+
+  for (int32_t from = 0; from < this->start_colors_size_; from += CHUNK_SIZE) {
+    const int32_t count = std::min(this->start_colors_size_ - from, CHUNK_SIZE);
+    // Plain loop over the channels of all LEDs of the chunk, so the compiler can unroll and vectorize it.
+    const auto *start = reinterpret_cast<const uint8_t *>(this->start_colors_ + from);
+    auto *out = reinterpret_cast<uint8_t *>(colors);
+    for (int32_t i = 0; i < count * 4; i++) {
+      const int32_t delta = target[i & 3] - start[i];
+      out[i] = start[i] + ((delta * w + half) >> 16);
+    }
+    this->light_.write_span(from, colors, count);
+  }
+}
 
-  // We can't use a direct lerp smoothing here though - that would require creating a copy of the original
-  // state of each LED at the start of the transition.
+void AddressableLightTransformer::apply_exponential_(float smoothed_progress) {
+  // We can't use a direct lerp smoothing here without the original state of each LED.
   // Instead, we "fake" the look of the LERP by using an exponential average over time and using
   // dynamically-calculated alpha values to match the look.
 
@@ -105,8 +248,6 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
 
   this->last_transition_progress_ = smoothed_progress;
   this->light_.schedule_show();
-
-  return {};
 }
 
 }  // namespace light
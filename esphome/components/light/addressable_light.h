@@ -22,6 +22,19 @@ using ESPColor ESPDEPRECATED("esphome::light::ESPColor is deprecated, use esphom
 /// Convert the color information from a `LightColorValues` object to a `Color` object (does not apply brightness).
 Color color_from_light_color_values(LightColorValues val);
 
+/// Layout of a light that keeps all its LEDs in one buffer, see AddressableLight::get_pixel_buffer_().
+struct PixelBuffer {
+  /// First byte of the first LED, nullptr if the light doesn't have such a buffer.
+  uint8_t *data{nullptr};
+  /// Bytes per LED.
+  uint8_t stride{0};
+  /// Offsets of the channels within an LED, white is -1 if there is no white channel.
+  uint8_t red{0};
+  uint8_t green{0};
+  uint8_t blue{0};
+  int8_t white{-1};
+};
+
 /// Use a custom state class for addressable lights, to allow type system to discriminate between addressable and
 /// non-addressable lights.
 class AddressableLightState : public LightState {
@@ -31,8 +44,13 @@ class AddressableLightState : public LightState {
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
-  ESPColorView operator[](int32_t index) const { return this->get_view_internal(interpret_index(index, this->size())); }
-  ESPColorView get(int32_t index) { return this->get_view_internal(interpret_index(index, this->size())); }
+  ESPColorView operator[](int32_t index) const {
+    index = interpret_index(index, this->size());
+    // the view might be written to, so the LED counts as changed
+    this->mark_dirty(index, index + 1);
+    return this->get_view_internal(index);
+  }
+  ESPColorView get(int32_t index) { return (*this)[index]; }
   virtual void clear_effect_data() = 0;
   ESPRangeView range(int32_t from, int32_t to) {
     from = interpret_index(from, this->size());
@@ -49,7 +67,7 @@ class AddressableLight : public LightOutput, public Component {
     }
     if (amnt > this->size())
       amnt = this->size();
-    this->range(0, -amnt) = this->range(amnt, this->size());
+    this->blit(0, amnt, this->size() - amnt);
   }
   void shift_right(int32_t amnt) {
     if (amnt < 0) {
@@ -58,8 +76,29 @@ class AddressableLight : public LightOutput, public Component {
     }
     if (amnt > this->size())
       amnt = this->size();
-    this->range(amnt, this->size()) = this->range(0, -amnt);
+    this->blit(amnt, 0, this->size() - amnt);
   }
+  /// Set the LEDs in [from, to) to \p color, like assigning it to range(from, to) but without a view for every LED.
+  void fill(int32_t from, int32_t to, const Color &color);
+  /// Set the \p count LEDs starting at \p from to \p colors.
+  void write_span(int32_t from, const Color *colors, int32_t count);
+  /// Copy \p count LEDs starting at \p src_from to \p from, the two may overlap. Lights with a pixel buffer copy the
+  /// colors as they are instead of uncorrecting and correcting them again.
+  void blit(int32_t from, int32_t src_from, int32_t count);
+  /// Mark the LEDs in [from, to) as changed. Views, range() and the bulk functions do this already, this is only
+  /// needed when writing to the LEDs some other way.
+  void mark_dirty(int32_t from, int32_t to) const {
+    if (from < this->dirty_from_)
+      this->dirty_from_ = from;
+    if (to > this->dirty_to_)
+      this->dirty_to_ = to;
+  }
+  /// Number of writes that were skipped because no LED changed.
+  uint32_t get_skipped_writes() const { return this->skipped_writes_; }
+  /// Number of writes that only sent a part of the LEDs.
+  uint32_t get_partial_writes() const { return this->partial_writes_; }
+  /// Number of writes that sent all LEDs.
+  uint32_t get_full_writes() const { return this->full_writes_; }
   // Indicates whether an effect that directly updates the output buffer is active to prevent overwriting
   bool is_effect_active() const { return this->effect_active_; }
   void set_effect_active(bool effect_active) { this->effect_active_ = effect_active; }
@@ -73,7 +112,7 @@ class AddressableLight : public LightOutput, public Component {
     this->state_parent_ = state;
   }
   void update_state(LightState *state) override;
-  void schedule_show() { this->state_parent_->next_write_ = true; }
+  virtual void schedule_show() { this->state_parent_->next_write_ = true; }
 
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
@@ -86,7 +125,11 @@ class AddressableLight : public LightOutput, public Component {
 
   void mark_shown_() {
 #ifdef USE_POWER_SUPPLY
-    for (const auto &c : *this) {
+    // Reading the LEDs of lights built on others (like partitions) marks them changed in those, so don't if not needed
+    if (!this->power_.has_parent())
+      return;
+    for (int32_t i = 0; i < this->size(); i++) {
+      const auto c = this->get_view_internal(i);
       if (c.get_red_raw() > 0 || c.get_green_raw() > 0 || c.get_blue_raw() > 0 || c.get_white_raw() > 0) {
         this->power_.request();
         return;
@@ -95,9 +138,24 @@ class AddressableLight : public LightOutput, public Component {
     this->power_.unrequest();
 #endif
   }
+  /** Take the LEDs that changed since the last call as [from, to), for write_state() to only send or encode those.
+   *
+   * Returns false if nothing changed, the write can be skipped then. Everything counts as changed before the first
+   * call. The result is counted in the write counters.
+   */
+  bool take_dirty_range_(int32_t &from, int32_t &to);
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  /// Lights that keep their LEDs in one buffer return its layout, so fill(), write_span() and blit() can write to it
+  /// directly. The others go through get_view_internal() for every LED.
+  virtual PixelBuffer get_pixel_buffer_() const { return {}; }
 
   bool effect_active_{false};
+  /// LEDs changed since the last take_dirty_range_(), empty if dirty_from_ >= dirty_to_.
+  mutable int32_t dirty_from_{0};
+  mutable int32_t dirty_to_{INT32_MAX};
+  uint32_t skipped_writes_{0};
+  uint32_t partial_writes_{0};
+  uint32_t full_writes_{0};
   ESPColorCorrection correction_{};
 #ifdef USE_POWER_SUPPLY
   power_supply::PowerSupplyRequester power_;
@@ -108,13 +166,23 @@ class AddressableLight : public LightOutput, public Component {
 class AddressableLightTransformer : public LightTransitionTransformer {
  public:
   AddressableLightTransformer(AddressableLight &light) : light_(light) {}
+  ~AddressableLightTransformer() override;
 
   void start() override;
   optional<LightColorValues> apply() override;
 
  protected:
+  /// Interpolate every LED from its start color to the target color, \p weight is in Q16.
+  void apply_q16_(uint32_t weight);
+  /// Without start colors, fade towards the target color with an exponential average instead.
+  void apply_exponential_(float smoothed_progress);
+
   AddressableLight &light_;
   Color target_color_{};
+  /// Color of each LED when the transition started, nullptr if it couldn't be allocated.
+  Color *start_colors_{nullptr};
+  int32_t start_colors_size_{0};
+  uint32_t last_weight_{0};
   float last_transition_progress_{0.0f};
   float accumulated_alpha_{0.0f};
 };
@@ -44,8 +44,17 @@ class AddressableLightEffect : public LightEffect {
     this->apply(*this->get_addressable_(), current_color);
   }
 
+  /// Render into \p layer instead of the light, see AddressableLayersEffect.
+  void set_layer(AddressableLight *layer) { this->layer_ = layer; }
+
  protected:
-  AddressableLight *get_addressable_() const { return (AddressableLight *) this->state_->get_output(); }
+  AddressableLight *get_addressable_() const {
+    if (this->layer_ != nullptr)
+      return this->layer_;
+    return (AddressableLight *) this->state_->get_output();
+  }
+
+  AddressableLight *layer_{nullptr};
 };
 
 class AddressableLambdaLightEffect : public AddressableLightEffect {
@@ -0,0 +1,164 @@
+#include "addressable_light_layer.h"
+#include <algorithm>
+#include <cstring>
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace light {
+
+static const char *const TAG = "light.layers";
+
+AddressableLightLayer::AddressableLightLayer(int32_t offset, int32_t size, LayerBlendMode blend_mode, uint8_t opacity)
+    : offset_(offset), size_(size), blend_mode_(blend_mode), opacity_(opacity) {
+  // Colors are kept as written, with neither gamma nor brightness applied
+  this->correction_.calculate_gamma_table(0.0f);
+
+  ExternalRAMAllocator<uint8_t> allocator;
+  auto *buffer = allocator.allocate(this->size_ * (sizeof(Color) + 1));
+  if (buffer == nullptr) {
+    this->size_ = 0;
+    return;
+  }
+  memset(buffer, 0, this->size_ * (sizeof(Color) + 1));
+  this->colors_ = reinterpret_cast<Color *>(buffer);
+  this->effect_data_ = buffer + this->size_ * sizeof(Color);
+}
+
+AddressableLightLayer::~AddressableLightLayer() {
+  if (this->colors_ != nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator;
+    allocator.deallocate(reinterpret_cast<uint8_t *>(this->colors_), this->size_ * (sizeof(Color) + 1));
+  }
+}
+
+void AddressableLightLayer::clear_effect_data() { memset(this->effect_data_, 0, this->size_); }
+
+ESPColorView AddressableLightLayer::get_view_internal(int32_t index) const {
+  Color &color = this->colors_[index];
+  return ESPColorView(&color.red, &color.green, &color.blue, &color.white, this->effect_data_ + index,
+                      &this->correction_);
+}
+
+PixelBuffer AddressableLightLayer::get_pixel_buffer_() const {
+  PixelBuffer buffer;
+  buffer.data = reinterpret_cast<uint8_t *>(this->colors_);
+  buffer.stride = sizeof(Color);
+  buffer.red = 0;
+  buffer.green = 1;
+  buffer.blue = 2;
+  buffer.white = 3;
+  return buffer;
+}
+
+void AddressableLightLayer::blend_onto(Color *colors, int32_t from, int32_t count) const {
+  const int32_t begin = std::max(from, this->offset_);
+  const int32_t end = std::min(from + count, this->offset_ + this->size_);
+  if (begin >= end || this->opacity_ == 0)
+    return;
+
+  Color *dst = colors + (begin - from);
+  const Color *src = this->colors_ + (begin - this->offset_);
+  const int32_t opacity = this->opacity_ + 1;
+  for (int32_t led = 0; led < end - begin; led++) {
+    // The LEDs the effect left black let the layers below show through
+    if (this->blend_mode_ == LAYER_BLEND_ALPHA && src[led].raw_32 == 0)
+      continue;
+    for (uint8_t channel = 0; channel < 4; channel++) {
+      const int32_t below = dst[led].raw[channel];
+      const int32_t above = src[led].raw[channel];
+      int32_t blended;
+      switch (this->blend_mode_) {
+        case LAYER_BLEND_ADD:
+          blended = std::min(below + above, 255);
+          break;
+        case LAYER_BLEND_MAX:
+          blended = std::max(below, above);
+          break;
+        case LAYER_BLEND_ALPHA:
+        default:
+          blended = above;
+          break;
+      }
+      // Rounded, so a low opacity doesn't pull the colors below down
+      dst[led].raw[channel] = below + (((blended - below) * opacity + 128) >> 8);
+    }
+  }
+}
+
+void AddressableLayersEffect::add_layer(AddressableLightEffect *effect, int32_t from, int32_t to,
+                                        LayerBlendMode blend_mode, float opacity) {
+  this->layers_.push_back(Layer{effect, from, to, blend_mode, to_uint8_scale(opacity), nullptr});
+}
+
+void AddressableLayersEffect::init() {
+  const int32_t size = this->get_addressable_()->size();
+  for (auto &layer : this->layers_) {
+    layer.to = layer.to < 0 ? size - 1 : std::min(layer.to, size - 1);
+    if (layer.from > layer.to) {
+      ESP_LOGE(TAG, "'%s': layer of '%s' is outside of the light", this->name_.c_str(),
+               layer.effect->get_name().c_str());
+      continue;
+    }
+    layer.effect->init_internal(this->state_);
+  }
+}
+
+void AddressableLayersEffect::start() {
+  for (auto &layer : this->layers_) {
+    if (layer.from > layer.to)
+      continue;
+    auto light =
+        make_unique<AddressableLightLayer>(layer.from, layer.to - layer.from + 1, layer.blend_mode, layer.opacity);
+    if (light->size() == 0) {
+      ESP_LOGE(TAG, "'%s': could not allocate the layer of '%s'", this->name_.c_str(),
+               layer.effect->get_name().c_str());
+      continue;
+    }
+    layer.light = std::move(light);
+    layer.effect->set_layer(layer.light.get());
+    layer.effect->start_internal();
+  }
+  this->initial_run_ = true;
+}
+
+void AddressableLayersEffect::stop() {
+  for (auto &layer : this->layers_) {
+    if (layer.light == nullptr)
+      continue;
+    layer.effect->stop();
+    layer.effect->set_layer(nullptr);
+    layer.light.reset();
+  }
+  AddressableLightEffect::stop();
+}
+
+void AddressableLayersEffect::apply(AddressableLight &it, const Color &current_color) {
+  bool changed = this->initial_run_;
+  this->initial_run_ = false;
+  for (auto &layer : this->layers_) {
+    if (layer.light == nullptr)
+      continue;
+    layer.effect->apply();
+    changed |= layer.light->take_changed();
+  }
+  if (!changed)
+    return;
+
+  // Composite the layers chunk by chunk on the stack, the light is written once
+  static const int32_t CHUNK_SIZE = 64;
+  Color colors[CHUNK_SIZE];
+  for (int32_t from = 0; from < it.size(); from += CHUNK_SIZE) {
+    const int32_t count = std::min(it.size() - from, CHUNK_SIZE);
+    std::fill(colors, colors + count, Color::BLACK);
+    for (auto &layer : this->layers_) {
+      if (layer.light != nullptr)
+        layer.light->blend_onto(colors, from, count);
+    }
+    it.write_span(from, colors, count);
+  }
+  it.schedule_show();
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "addressable_light.h"
+#include "addressable_light_effect.h"
+
+namespace esphome {
+namespace light {
+
+/// How the colors of a layer are combined with the layers below it.
+enum LayerBlendMode : uint8_t {
+  /// Cover the layers below with the LEDs this layer lights, black LEDs are transparent.
+  LAYER_BLEND_ALPHA = 0,
+  /// Add to the layers below, saturating at full brightness.
+  LAYER_BLEND_ADD,
+  /// Keep the brightest of this layer and the layers below, per channel.
+  LAYER_BLEND_MAX,
+};
+
+/** An addressable light kept in memory that one effect renders into.
+ *
+ * The colors are stored as they are written, without correction. AddressableLayersEffect blends them onto a segment
+ * of the real light.
+ */
+class AddressableLightLayer final : public AddressableLight {
+ public:
+  AddressableLightLayer(int32_t offset, int32_t size, LayerBlendMode blend_mode, uint8_t opacity);
+  ~AddressableLightLayer();
+
+  int32_t size() const override { return this->size_; }
+  void clear_effect_data() override;
+  LightTraits get_traits() override { return {}; }
+  void write_state(LightState *state) override {}
+  /// Only remembers that the effect drew something, the layers are shown together.
+  void schedule_show() override { this->changed_ = true; }
+
+  /// Whether the effect drew anything since the last call.
+  bool take_changed() {
+    bool changed = this->changed_;
+    this->changed_ = false;
+    return changed;
+  }
+  /// Blend this layer onto \p colors, the \p count LEDs of the real light starting at \p from.
+  void blend_onto(Color *colors, int32_t from, int32_t count) const;
+
+ protected:
+  ESPColorView get_view_internal(int32_t index) const override;
+  PixelBuffer get_pixel_buffer_() const override;
+
+  int32_t offset_;
+  int32_t size_;
+  LayerBlendMode blend_mode_;
+  uint8_t opacity_;
+  bool changed_{false};
+  Color *colors_{nullptr};
+  uint8_t *effect_data_{nullptr};
+};
+
+/** Runs several addressable effects at once, each on its own layer over a segment of the light.
+ *
+ * Every effect renders into the buffer of its layer. When any of them drew something, the layers are blended in
+ * order, bottom first, and written to the light in one pass. LEDs that no layer covers are off. The layer buffers are
+ * only allocated while the effect runs.
+ */
+class AddressableLayersEffect : public AddressableLightEffect {
+ public:
+  explicit AddressableLayersEffect(const std::string &name) : AddressableLightEffect(name) {}
+
+  /// Add a layer for \p effect over the LEDs \p from to \p to (-1 for the last LED), on top of the ones added before.
+  void add_layer(AddressableLightEffect *effect, int32_t from, int32_t to, LayerBlendMode blend_mode, float opacity);
+
+  void init() override;
+  void start() override;
+  void stop() override;
+  void apply(AddressableLight &it, const Color &current_color) override;
+
+ protected:
+  struct Layer {
+    AddressableLightEffect *effect;
+    int32_t from;
+    int32_t to;
+    LayerBlendMode blend_mode;
+    uint8_t opacity;
+    std::unique_ptr<AddressableLightLayer> light;
+  };
+
+  std::vector<Layer> layers_;
+  bool initial_run_{false};
+};
+
+}  // namespace light
+}  // namespace esphome
@@ -76,6 +76,10 @@ class AddressableLightWrapper : public light::AddressableLight {
       this->mark_shown_();
       return;
     }
+    // Only send a call to the underlying light when the color changed
+    int32_t from, to;
+    if (!this->take_dirty_range_(from, to))
+      return;
 
     float gamma = this->light_state_->get_gamma_correct();
     float r = gamma_uncorrect(this->wrapper_state_[0] / 255.0f, gamma);
@@ -11,6 +11,8 @@ from esphome.const import (
     CONF_COLOR_TEMPERATURE,
     CONF_COLORS,
     CONF_DURATION,
+    CONF_EFFECT,
+    CONF_FROM,
     CONF_GREEN,
     CONF_INTENSITY,
     CONF_LAMBDA,
@@ -23,6 +25,7 @@ from esphome.const import (
     CONF_SEQUENCE,
     CONF_SPEED,
     CONF_STATE,
+    CONF_TO,
     CONF_TRANSITION_LENGTH,
     CONF_UPDATE_INTERVAL,
     CONF_WARM_WHITE,
@@ -34,11 +37,13 @@ from esphome.util import Registry
 
 from .types import (
     COLOR_MODES,
+    LAYER_BLEND_MODES,
     AddressableColorWipeEffect,
     AddressableColorWipeEffectColor,
     AddressableFireworksEffect,
     AddressableFlickerEffect,
     AddressableLambdaLightEffect,
+    AddressableLayersEffect,
     AddressableLightRef,
     AddressableRainbowLightEffect,
     AddressableRandomTwinkleEffect,
@@ -76,6 +81,10 @@ CONF_ADDRESSABLE_TWINKLE = "addressable_twinkle"
 CONF_ADDRESSABLE_RANDOM_TWINKLE = "addressable_random_twinkle"
 CONF_ADDRESSABLE_FIREWORKS = "addressable_fireworks"
 CONF_ADDRESSABLE_FLICKER = "addressable_flicker"
+CONF_ADDRESSABLE_LAYERS = "addressable_layers"
+CONF_LAYERS = "layers"
+CONF_BLEND_MODE = "blend_mode"
+CONF_OPACITY = "opacity"
 CONF_AUTOMATION = "automation"
 CONF_ON_LENGTH = "on_length"
 CONF_OFF_LENGTH = "off_length"
@@ -84,6 +93,8 @@ BINARY_EFFECTS = []
 MONOCHROMATIC_EFFECTS = []
 RGB_EFFECTS = []
 ADDRESSABLE_EFFECTS = []
+# Effects that only draw to the LEDs, these can run on a layer of addressable_layers
+ADDRESSABLE_ONLY_EFFECTS = []
 
 EFFECTS_REGISTRY = Registry()
 
@@ -132,6 +143,7 @@ def register_addressable_effect(
 ):
     # addressable effect can be used only in addressable
     ADDRESSABLE_EFFECTS.append(name)
+    ADDRESSABLE_ONLY_EFFECTS.append(name)
 
     return register_effect(name, effect_type, default_name, schema, *extra_validators)
 
@@ -516,6 +528,58 @@ async def addressable_flicker_effect_to_code(config, effect_id):
     return var
 
 
+def validate_layer_effect(value):
+    allowed = [x for x in ADDRESSABLE_ONLY_EFFECTS if x != CONF_ADDRESSABLE_LAYERS]
+    return validate_effects(allowed)([value])[0]
+
+
+def validate_layer_range(value):
+    if CONF_TO in value and value[CONF_TO] < value[CONF_FROM]:
+        raise cv.Invalid(
+            f"The layer ends at LED {value[CONF_TO]}, before it starts", [CONF_TO]
+        )
+    return value
+
+
+@register_addressable_effect(
+    CONF_ADDRESSABLE_LAYERS,
+    AddressableLayersEffect,
+    "Layers",
+    {
+        cv.Required(CONF_LAYERS): cv.ensure_list(
+            cv.All(
+                cv.Schema(
+                    {
+                        cv.Required(CONF_EFFECT): validate_layer_effect,
+                        cv.Optional(CONF_FROM, default=0): cv.int_range(min=0),
+                        cv.Optional(CONF_TO): cv.int_range(min=0),
+                        cv.Optional(CONF_BLEND_MODE, default="ALPHA"): cv.enum(
+                            LAYER_BLEND_MODES, upper=True
+                        ),
+                        cv.Optional(CONF_OPACITY, default="100%"): cv.percentage,
+                    }
+                ),
+                validate_layer_range,
+            )
+        ),
+    },
+)
+async def addressable_layers_effect_to_code(config, effect_id):
+    var = cg.new_Pvariable(effect_id, config[CONF_NAME])
+    for layer in config[CONF_LAYERS]:
+        effects = await cg.build_registry_list(EFFECTS_REGISTRY, [layer[CONF_EFFECT]])
+        cg.add(
+            var.add_layer(
+                effects[0],
+                layer[CONF_FROM],
+                layer.get(CONF_TO, -1),
+                layer[CONF_BLEND_MODE],
+                layer[CONF_OPACITY],
+            )
+        )
+    return var
+
+
 def validate_effects(allowed_effects):
     @schema_extractor("effects")
     def validator(value):
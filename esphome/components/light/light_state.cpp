@@ -147,10 +147,10 @@ std::string LightState::get_effect_name() {
   }
 }
 
-void LightState::add_new_remote_values_callback(std::function<void()> &&send_callback) {
+void LightState::add_new_remote_values_callback(InlineFunction<void()> &&send_callback) {
   this->remote_values_callback_.add(std::move(send_callback));
 }
-void LightState::add_new_target_state_reached_callback(std::function<void()> &&send_callback) {
+void LightState::add_new_target_state_reached_callback(InlineFunction<void()> &&send_callback) {
   this->target_state_reached_callback_.add(std::move(send_callback));
 }
 
@@ -234,6 +234,7 @@ void LightState::stop_effect_() {
 
 void LightState::start_transition_(const LightColorValues &target, uint32_t length, bool set_remote_values) {
   this->transformer_ = this->output_->create_default_transition();
+  this->transformer_->set_easing(this->transition_easing_);
   this->transformer_->setup(this->current_values, target, length);
 
   if (set_remote_values) {
@@ -249,6 +250,7 @@ void LightState::start_flash_(const LightColorValues &target, uint32_t length, b
     end_colors = this->transformer_->get_start_values();
 
   this->transformer_ = make_unique<LightFlashTransformer>(*this);
+  this->transformer_->set_easing(this->transition_easing_);
   this->transformer_->setup(end_colors, target, length);
 
   if (set_remote_values) {
@@ -120,7 +120,7 @@ class LightState : public EntityBase, public Component {
    *
    * @param send_callback The callback.
    */
-  void add_new_remote_values_callback(std::function<void()> &&send_callback);
+  void add_new_remote_values_callback(InlineFunction<void()> &&send_callback);
 
   /**
    * The callback is called once the state of current_values and remote_values are equal (when the
@@ -128,7 +128,7 @@ class LightState : public EntityBase, public Component {
    *
    * @param send_callback
    */
-  void add_new_target_state_reached_callback(std::function<void()> &&send_callback);
+  void add_new_target_state_reached_callback(InlineFunction<void()> &&send_callback);
 
   /// Set the default transition length, i.e. the transition length when no transition is provided.
   void set_default_transition_length(uint32_t default_transition_length);
@@ -138,6 +138,10 @@ class LightState : public EntityBase, public Component {
   void set_flash_transition_length(uint32_t flash_transition_length);
   uint32_t get_flash_transition_length() const;
 
+  /// Set the curve that transitions follow
+  void set_transition_easing(TransitionEasing transition_easing) { this->transition_easing_ = transition_easing; }
+  TransitionEasing get_transition_easing() const { return this->transition_easing_; }
+
   /// Set the gamma correction factor
   void set_gamma_correct(float gamma_correct);
   float get_gamma_correct() const { return this->gamma_correct_; }
@@ -240,6 +244,7 @@ class LightState : public EntityBase, public Component {
   uint32_t default_transition_length_{};
   /// Transition length to use for flash transitions.
   uint32_t flash_transition_length_{};
+  TransitionEasing transition_easing_{TRANSITION_EASING_SMOOTH};
   /// Gamma correction factor for the light.
   float gamma_correct_{};
   /// Restore mode of the light.
@@ -3,6 +3,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/hal.h"
 #include "light_color_values.h"
+#include "transition_easing.h"
 
 namespace esphome {
 namespace light {
@@ -37,6 +38,9 @@ class LightTransformer {
 
   const LightColorValues &get_target_values() const { return this->target_values_; }
 
+  /// Set the curve used for the progress of transitions, call before setup().
+  void set_easing(TransitionEasing easing) { this->easing_ = easing; }
+
  protected:
   /// The progress of this transition, on a scale of 0 to 1.
   float get_progress_() {
@@ -49,10 +53,22 @@ class LightTransformer {
     return clamp((now - this->start_time_) / float(this->length_), 0.0f, 1.0f);
   }
 
+  /// The progress of this transition, in Q16 fixed point from 0 to Q16_ONE.
+  uint32_t get_progress_q16_() {
+    uint32_t now = esphome::millis();
+    if (now < this->start_time_)
+      return 0;
+    if (now >= this->start_time_ + this->length_)
+      return Q16_ONE;
+
+    return (uint64_t(now - this->start_time_) << 16) / this->length_;
+  }
+
   uint32_t start_time_;
   uint32_t length_;
   LightColorValues start_values_;
   LightColorValues target_values_;
+  TransitionEasing easing_{TRANSITION_EASING_SMOOTH};
 };
 
 }  // namespace light
@@ -36,29 +36,26 @@ class LightTransitionTransformer : public LightTransformer {
   }
 
   optional<LightColorValues> apply() override {
-    float p = this->get_progress_();
+    uint32_t p = this->get_progress_q16_();
+    const uint32_t half = Q16_ONE / 2;
 
     // Halfway through, when intermediate state (off) is reached, flip it to the target, but remain off.
-    if (this->changing_color_mode_ && p > 0.5f &&
+    if (this->changing_color_mode_ && p > half &&
         this->intermediate_values_.get_color_mode() != this->target_values_.get_color_mode()) {
       this->intermediate_values_ = this->target_values_;
       this->intermediate_values_.set_state(false);
     }
 
-    LightColorValues &start = this->changing_color_mode_ && p > 0.5f ? this->intermediate_values_ : this->start_values_;
-    LightColorValues &end = this->changing_color_mode_ && p < 0.5f ? this->intermediate_values_ : this->end_values_;
+    LightColorValues &start = this->changing_color_mode_ && p > half ? this->intermediate_values_ : this->start_values_;
+    LightColorValues &end = this->changing_color_mode_ && p < half ? this->intermediate_values_ : this->end_values_;
     if (this->changing_color_mode_)
-      p = p < 0.5f ? p * 2 : (p - 0.5) * 2;
+      p = p < half ? p * 2 : (p - half) * 2;
 
-    float v = LightTransitionTransformer::smoothed_progress(p);
+    float v = ease_q16(this->easing_, p) / float(Q16_ONE);
     return LightColorValues::lerp(start, end, v);
   }
 
  protected:
-  // This looks crazy, but it reduces to 6x^5 - 15x^4 + 10x^3 which is just a smooth sigmoid-like
-  // transition from 0 to 1 on x = [0, 1]
-  static float smoothed_progress(float x) { return x * x * x * (x * (x * 6.0f - 15.0f) + 10.0f); }
-
   bool changing_color_mode_{false};
   LightColorValues end_values_{};
   LightColorValues intermediate_values_{};
@@ -77,6 +74,7 @@ class LightFlashTransformer : public LightTransformer {
 
     // first transition to original target
     this->transformer_ = this->state_.get_output()->create_default_transition();
+    this->transformer_->set_easing(this->easing_);
     this->transformer_->setup(this->state_.current_values, this->target_values_, this->transition_length_);
   }
 
@@ -86,6 +84,7 @@ class LightFlashTransformer : public LightTransformer {
     if (this->transformer_ == nullptr && millis() > this->start_time_ + this->length_ - this->transition_length_) {
       // second transition back to start value
       this->transformer_ = this->state_.get_output()->create_default_transition();
+      this->transformer_->set_easing(this->easing_);
       this->transformer_->setup(this->state_.current_values, this->get_start_values(), this->transition_length_);
       this->begun_lightstate_restore_ = true;
     }
@@ -0,0 +1,58 @@
+#include "transition_easing.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace light {
+
+// The curves sampled at 65 points (64 segments), scaled to 65535, and linearly interpolated in between.
+static const uint8_t EASING_TABLE_BITS = 6;
+static const uint8_t EASING_SEGMENT_BITS = 16 - EASING_TABLE_BITS;
+
+static const uint16_t PROGMEM EASING_TABLES[][(1 << EASING_TABLE_BITS) + 1] = {
+    // TRANSITION_EASING_SMOOTH
+    {
+        0,     2,     19,    63,    145,   277,   467,   723,   1052,  1460,  1951,  2529,  3196,
+        3955,  4806,  5749,  6784,  7909,  9121,  10418, 11797, 13253, 14781, 16377, 18036, 19750,
+        21515, 23323, 25167, 27041, 28938, 30849, 32768, 34686, 36597, 38494, 40368, 42212, 44020,
+        45785, 47499, 49158, 50754, 52282, 53738, 55117, 56414, 57626, 58751, 59786, 60729, 61580,
+        62339, 63006, 63584, 64075, 64483, 64812, 65068, 65258, 65390, 65472, 65516, 65533, 65535,
+    },
+    // TRANSITION_EASING_EASE_IN
+    {
+        0,     0,     2,     7,     16,    31,    54,    86,    128,   182,   250,   333,   432,
+        549,   686,   844,   1024,  1228,  1458,  1715,  2000,  2315,  2662,  3042,  3456,  3906,
+        4394,  4921,  5488,  6097,  6750,  7448,  8192,  8984,  9826,  10719, 11664, 12663, 13718,
+        14830, 16000, 17230, 18522, 19876, 21296, 22781, 24334, 25955, 27648, 29412, 31250, 33162,
+        35151, 37219, 39365, 41593, 43903, 46298, 48777, 51344, 53999, 56744, 59581, 62511, 65535,
+    },
+    // TRANSITION_EASING_EASE_OUT
+    {
+        0,     3024,  5954,  8791,  11536, 14191, 16758, 19237, 21632, 23942, 26170, 28316, 30384,
+        32373, 34285, 36123, 37887, 39580, 41201, 42754, 44239, 45659, 47013, 48305, 49535, 50705,
+        51817, 52872, 53871, 54816, 55709, 56551, 57343, 58087, 58785, 59438, 60047, 60614, 61141,
+        61629, 62079, 62493, 62873, 63220, 63535, 63820, 64077, 64307, 64511, 64691, 64849, 64986,
+        65103, 65202, 65285, 65353, 65407, 65449, 65481, 65504, 65519, 65528, 65533, 65535, 65535,
+    },
+};
+
+static uint32_t read_entry(const uint16_t *entry) {
+  const auto *bytes = reinterpret_cast<const uint8_t *>(entry);
+  return progmem_read_byte(bytes) | (progmem_read_byte(bytes + 1) << 8);
+}
+
+uint32_t ease_q16(TransitionEasing easing, uint32_t progress) {
+  if (progress >= Q16_ONE)
+    return Q16_ONE;
+  if (easing == TRANSITION_EASING_LINEAR || easing > TRANSITION_EASING_EASE_OUT)
+    return progress;
+
+  const uint16_t *table = EASING_TABLES[easing - TRANSITION_EASING_SMOOTH];
+  const uint32_t index = progress >> EASING_SEGMENT_BITS;
+  const uint32_t fraction = progress & ((1 << EASING_SEGMENT_BITS) - 1);
+  const uint32_t from = read_entry(&table[index]);
+  const uint32_t to = read_entry(&table[index + 1]);
+  return from + (((to - from) * fraction) >> EASING_SEGMENT_BITS);
+}
+
+}  // namespace light
+}  // namespace esphome
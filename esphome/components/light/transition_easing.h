@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace light {
+
+/// Curve that maps the elapsed time of a transition to its progress.
+enum TransitionEasing : uint8_t {
+  TRANSITION_EASING_LINEAR = 0,
+  /// Smooth sigmoid-like curve, 6x^5 - 15x^4 + 10x^3.
+  TRANSITION_EASING_SMOOTH,
+  /// Starts slow and speeds up, x^3.
+  TRANSITION_EASING_EASE_IN,
+  /// Starts fast and slows down, 1 - (1 - x)^3.
+  TRANSITION_EASING_EASE_OUT,
+};
+
+/// Fixed point values with 16 fractional bits, this is 1.0.
+static const uint32_t Q16_ONE = 1 << 16;
+
+/// Apply \p easing to \p progress, both in Q16 from 0 to Q16_ONE.
+uint32_t ease_q16(TransitionEasing easing, uint32_t progress);
+
+}  // namespace light
+}  // namespace esphome
@@ -35,6 +35,15 @@ LIMIT_MODES = {
     "DO_NOTHING": LimitMode.DO_NOTHING,
 }
 
+# Transition easings
+TransitionEasing = light_ns.enum("TransitionEasing")
+TRANSITION_EASINGS = {
+    "LINEAR": TransitionEasing.TRANSITION_EASING_LINEAR,
+    "SMOOTH": TransitionEasing.TRANSITION_EASING_SMOOTH,
+    "EASE_IN": TransitionEasing.TRANSITION_EASING_EASE_IN,
+    "EASE_OUT": TransitionEasing.TRANSITION_EASING_EASE_OUT,
+}
+
 # Actions
 ToggleAction = light_ns.class_("ToggleAction", automation.Action)
 LightControlAction = light_ns.class_("LightControlAction", automation.Action)
@@ -85,3 +94,14 @@ AddressableFireworksEffect = light_ns.class_(
 AddressableFlickerEffect = light_ns.class_(
     "AddressableFlickerEffect", AddressableLightEffect
 )
+AddressableLayersEffect = light_ns.class_(
+    "AddressableLayersEffect", AddressableLightEffect
+)
+
+# Layer blend modes
+LayerBlendMode = light_ns.enum("LayerBlendMode")
+LAYER_BLEND_MODES = {
+    "ALPHA": LayerBlendMode.LAYER_BLEND_ALPHA,
+    "ADD": LayerBlendMode.LAYER_BLEND_ADD,
+    "MAX": LayerBlendMode.LAYER_BLEND_MAX,
+}
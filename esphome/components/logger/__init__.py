@@ -170,6 +170,7 @@ LoggerMessageTrigger = logger_ns.class_(
 )
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_TASK_LOG_BUFFER_SIZE = "task_log_buffer_size"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -216,6 +217,13 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(
                 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH, esp8266=True
             ): cv.All(cv.only_on_esp8266, cv.boolean),
+            cv.SplitDefault(
+                CONF_TASK_LOG_BUFFER_SIZE, esp32=768, bk72xx=768, rtl87xx=768
+            ): cv.All(
+                cv.only_on([PLATFORM_ESP32, PLATFORM_BK72XX, PLATFORM_RTL87XX]),
+                cv.validate_bytes,
+                cv.int_range(max=32768),
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
@@ -232,6 +240,9 @@ async def to_code(config):
                 HARDWARE_UART_TO_UART_SELECTION[config[CONF_HARDWARE_UART]]
             )
         )
+    if task_log_buffer_size := config.get(CONF_TASK_LOG_BUFFER_SIZE):
+        cg.add_define("USE_LOGGER_RING_BUFFER")
+        cg.add(log.init_log_buffer(task_log_buffer_size))
     cg.add(log.pre_setup())
 
     for tag, level in config[CONF_LOGS].items():
@@ -0,0 +1,353 @@
+#include "log_args.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+/// Strings passed as arguments are cut off after this many characters.
+static const size_t MAX_STRING_ARG_LENGTH = 255;
+
+enum class ArgLength : uint8_t { NONE, CHAR, SHORT, LONG, LONG_LONG, SIZE, INTMAX, PTRDIFF, LONG_DOUBLE };
+
+/// A printf conversion specification, from the '%' up to and including the conversion character.
+struct Conversion {
+  const char *start;
+  const char *end;
+  /// Number of '*' width/precision arguments in front of the value.
+  uint8_t stars;
+  ArgLength length;
+  /// The conversion character, 0 if the specification is incomplete.
+  char type;
+};
+
+static const char *parse_conversion(const char *p, Conversion *conv) {
+  conv->start = p++;
+  conv->stars = 0;
+  while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0')
+    p++;
+  if (*p == '*') {
+    conv->stars++;
+    p++;
+  }
+  while (*p >= '0' && *p <= '9')
+    p++;
+  if (*p == '.') {
+    p++;
+    if (*p == '*') {
+      conv->stars++;
+      p++;
+    }
+    while (*p >= '0' && *p <= '9')
+      p++;
+  }
+
+  conv->length = ArgLength::NONE;
+  switch (*p) {
+    case 'h':
+      p++;
+      conv->length = ArgLength::SHORT;
+      if (*p == 'h') {
+        p++;
+        conv->length = ArgLength::CHAR;
+      }
+      break;
+    case 'l':
+      p++;
+      conv->length = ArgLength::LONG;
+      if (*p == 'l') {
+        p++;
+        conv->length = ArgLength::LONG_LONG;
+      }
+      break;
+    case 'z':
+      p++;
+      conv->length = ArgLength::SIZE;
+      break;
+    case 'j':
+      p++;
+      conv->length = ArgLength::INTMAX;
+      break;
+    case 't':
+      p++;
+      conv->length = ArgLength::PTRDIFF;
+      break;
+    case 'L':
+      p++;
+      conv->length = ArgLength::LONG_DOUBLE;
+      break;
+    default:
+      break;
+  }
+
+  conv->type = *p;
+  if (*p != '\0')
+    p++;
+  conv->end = p;
+  return p;
+}
+
+static bool is_signed_type(char type) { return type == 'd' || type == 'i'; }
+static bool is_unsigned_type(char type) { return type == 'u' || type == 'o' || type == 'x' || type == 'X'; }
+static bool is_float_type(char type) { return type != '\0' && strchr("fFeEgGaA", type) != nullptr; }
+
+/// Append \p value to the packed arguments, or only count its size if \p out is null.
+template<typename T> static void pack(uint8_t *out, size_t &size, T value) {
+  if (out != nullptr)
+    std::memcpy(out + size, &value, sizeof(T));
+  size += sizeof(T);
+}
+
+template<typename T> static T unpack(const uint8_t *&in) {
+  T value;
+  std::memcpy(&value, in, sizeof(T));
+  in += sizeof(T);
+  return value;
+}
+
+/// Append \p value as a base 128 varint, like protobuf, or only count its size if \p out is null.
+static void pack_varint(uint8_t *out, size_t &size, uint64_t value) {
+  while (value >= 0x80) {
+    if (out != nullptr)
+      out[size] = static_cast<uint8_t>(value) | 0x80;
+    size++;
+    value >>= 7;
+  }
+  if (out != nullptr)
+    out[size] = static_cast<uint8_t>(value);
+  size++;
+}
+/// Signed values are zigzag encoded first, so small negative numbers stay short.
+static void pack_signed(uint8_t *out, size_t &size, int64_t value) {
+  pack_varint(out, size, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+static uint64_t unpack_varint(const uint8_t *&in) {
+  uint64_t value = 0;
+  for (uint8_t shift = 0;; shift += 7) {
+    const uint8_t byte = *in++;
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0 || shift >= 63)
+      return value;
+  }
+}
+static int64_t unpack_signed(const uint8_t *&in) {
+  const uint64_t value = unpack_varint(in);
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+size_t pack_log_args(const char *format, va_list args, uint8_t *out) {
+  size_t size = 0;
+  for (const char *p = format; *p != '\0';) {
+    if (*p != '%') {
+      p++;
+      continue;
+    }
+    Conversion conv;
+    p = parse_conversion(p, &conv);
+    if (conv.type == '%')
+      continue;
+    for (uint8_t i = 0; i < conv.stars; i++)
+      pack_signed(out, size, va_arg(args, int));
+
+    if (is_signed_type(conv.type)) {
+      int64_t value;
+      switch (conv.length) {
+        case ArgLength::LONG:
+          value = va_arg(args, long);
+          break;
+        case ArgLength::LONG_LONG:
+          value = va_arg(args, long long);
+          break;
+        case ArgLength::SIZE:
+          value = static_cast<int64_t>(va_arg(args, size_t));
+          break;
+        case ArgLength::INTMAX:
+          value = va_arg(args, intmax_t);
+          break;
+        case ArgLength::PTRDIFF:
+          value = va_arg(args, ptrdiff_t);
+          break;
+        default:
+          value = va_arg(args, int);
+          break;
+      }
+      pack_signed(out, size, value);
+    } else if (is_unsigned_type(conv.type)) {
+      uint64_t value;
+      switch (conv.length) {
+        case ArgLength::LONG:
+          value = va_arg(args, unsigned long);
+          break;
+        case ArgLength::LONG_LONG:
+          value = va_arg(args, unsigned long long);
+          break;
+        case ArgLength::SIZE:
+          value = va_arg(args, size_t);
+          break;
+        case ArgLength::INTMAX:
+          value = va_arg(args, uintmax_t);
+          break;
+        case ArgLength::PTRDIFF:
+          value = static_cast<uint64_t>(va_arg(args, ptrdiff_t));
+          break;
+        default:
+          value = va_arg(args, unsigned int);
+          break;
+      }
+      pack_varint(out, size, value);
+    } else if (is_float_type(conv.type)) {
+      if (conv.length == ArgLength::LONG_DOUBLE) {
+        pack<double>(out, size, static_cast<double>(va_arg(args, long double)));
+      } else {
+        pack<double>(out, size, va_arg(args, double));
+      }
+    } else if (conv.type == 'c') {
+      pack_signed(out, size, va_arg(args, int));
+    } else if (conv.type == 's') {
+      const char *str = va_arg(args, const char *);
+      if (str == nullptr)
+        str = "(null)";
+      size_t len = strnlen(str, MAX_STRING_ARG_LENGTH);
+      if (out != nullptr) {
+        std::memcpy(out + size, str, len);
+        out[size + len] = '\0';
+      }
+      size += len + 1;
+    } else if (conv.type == 'p') {
+      pack_varint(out, size, reinterpret_cast<uintptr_t>(va_arg(args, void *)));
+    } else if (conv.type == 'n') {
+      (void) va_arg(args, void *);
+    } else {
+      // Unknown conversion, format_log_args() prints the rest of the format string as it is
+      break;
+    }
+  }
+  return size;
+}
+
+template<typename T> static int print_arg(char *buf, size_t size, const char *spec, const int *stars, uint8_t count,
+                                          T value) {
+  switch (count) {
+    case 0:
+      return snprintf(buf, size, spec, value);
+    case 1:
+      return snprintf(buf, size, spec, stars[0], value);
+    default:
+      return snprintf(buf, size, spec, stars[0], stars[1], value);
+  }
+}
+
+size_t format_log_args(const char *format, const uint8_t *args, char *buf, size_t size) {
+  if (size == 0)
+    return 0;
+  size_t pos = 0;
+
+  const char *p = format;
+  while (*p != '\0' && pos + 1 < size) {
+    if (*p != '%') {
+      buf[pos++] = *p++;
+      continue;
+    }
+    Conversion conv;
+    const char *next = parse_conversion(p, &conv);
+    if (conv.type == '%') {
+      buf[pos++] = '%';
+      p = next;
+      continue;
+    }
+    char spec[24];
+    const size_t spec_len = conv.end - conv.start;
+    const bool known = is_signed_type(conv.type) || is_unsigned_type(conv.type) || is_float_type(conv.type) ||
+                       conv.type == 'c' || conv.type == 's' || conv.type == 'p' || conv.type == 'n';
+    if (!known || spec_len >= sizeof(spec)) {
+      // Print the rest as it is, the arguments can't be matched up anymore
+      while (*p != '\0' && pos + 1 < size)
+        buf[pos++] = *p++;
+      break;
+    }
+    std::memcpy(spec, conv.start, spec_len);
+    spec[spec_len] = '\0';
+    p = next;
+
+    int stars[2];
+    for (uint8_t i = 0; i < conv.stars; i++)
+      stars[i] = static_cast<int>(unpack_signed(args));
+
+    int ret = 0;
+    char *out = buf + pos;
+    const size_t room = size - pos;
+    if (is_signed_type(conv.type)) {
+      const auto value = unpack_signed(args);
+      switch (conv.length) {
+        case ArgLength::LONG:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<long>(value));
+          break;
+        case ArgLength::LONG_LONG:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<long long>(value));
+          break;
+        case ArgLength::SIZE:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<size_t>(value));
+          break;
+        case ArgLength::INTMAX:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<intmax_t>(value));
+          break;
+        case ArgLength::PTRDIFF:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<ptrdiff_t>(value));
+          break;
+        default:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<int>(value));
+          break;
+      }
+    } else if (is_unsigned_type(conv.type)) {
+      const auto value = unpack_varint(args);
+      switch (conv.length) {
+        case ArgLength::LONG:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<unsigned long>(value));
+          break;
+        case ArgLength::LONG_LONG:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<unsigned long long>(value));
+          break;
+        case ArgLength::SIZE:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<size_t>(value));
+          break;
+        case ArgLength::INTMAX:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<uintmax_t>(value));
+          break;
+        case ArgLength::PTRDIFF:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<ptrdiff_t>(value));
+          break;
+        default:
+          ret = print_arg(out, room, spec, stars, conv.stars, static_cast<unsigned int>(value));
+          break;
+      }
+    } else if (is_float_type(conv.type)) {
+      const auto value = unpack<double>(args);
+      if (conv.length == ArgLength::LONG_DOUBLE) {
+        ret = print_arg(out, room, spec, stars, conv.stars, static_cast<long double>(value));
+      } else {
+        ret = print_arg(out, room, spec, stars, conv.stars, value);
+      }
+    } else if (conv.type == 'c') {
+      ret = print_arg(out, room, spec, stars, conv.stars, static_cast<int>(unpack_signed(args)));
+    } else if (conv.type == 's') {
+      const char *str = reinterpret_cast<const char *>(args);
+      args += strlen(str) + 1;
+      ret = print_arg(out, room, spec, stars, conv.stars, str);
+    } else if (conv.type == 'p') {
+      const auto value = static_cast<uintptr_t>(unpack_varint(args));
+      ret = print_arg(out, room, spec, stars, conv.stars, reinterpret_cast<void *>(value));
+    }
+    // %n prints nothing and its pointer wasn't stored
+
+    if (ret > 0)
+      pos += std::min(static_cast<size_t>(ret), room - 1);
+  }
+  buf[pos] = '\0';
+  return pos;
+}
+
+}  // namespace logger
+}  // namespace esphome
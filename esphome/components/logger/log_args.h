@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace logger {
+
+/** Pack the arguments \p format refers to into \p out and return their size, only count the size if \p out is null.
+ *
+ * Integers, characters and pointers are stored as varints like protobuf's (zigzag encoded when signed), so most take
+ * one or two bytes. Floating point numbers are stored as doubles in native byte order and without alignment, strings
+ * are copied (up to 255 characters, NUL terminated). Width and precision arguments given with '*' come first, as
+ * signed varints. The packing stops at the first conversion that isn't understood.
+ */
+size_t pack_log_args(const char *format, va_list args, uint8_t *out);
+
+/// Print \p format with arguments packed by pack_log_args() into \p buf, like snprintf(). Returns the length printed.
+size_t format_log_args(const char *format, const uint8_t *args, char *buf, size_t size);
+
+}  // namespace logger
+}  // namespace esphome
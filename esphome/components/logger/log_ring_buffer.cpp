@@ -0,0 +1,102 @@
+#include "log_ring_buffer.h"
+
+#ifdef USE_LOGGER_RING_BUFFER
+
+#include <cstring>
+
+#include "log_args.h"
+
+namespace esphome {
+namespace logger {
+
+static const uint32_t RECORD_ALIGNMENT = alignof(LogRingBuffer::Record);
+
+LogRingBuffer::LogRingBuffer(size_t size) {
+  uint32_t ring_size = 64;
+  while (ring_size < size)
+    ring_size <<= 1;
+  this->buffer_ = std::unique_ptr<uint8_t[]>{new uint8_t[ring_size]()};  // NOLINT
+  this->size_ = ring_size;
+  this->mask_ = ring_size - 1;
+}
+
+bool LogRingBuffer::push(int level, const char *tag, int line, const char *thread_name, const char *format,
+                         va_list args) {
+  va_list args_copy;
+  va_copy(args_copy, args);
+  const size_t args_size = pack_log_args(format, args_copy, nullptr);
+  va_end(args_copy);
+  // The format string is copied too, some callers build it at runtime
+  const size_t format_size = strlen(format) + 1;
+  const size_t args_offset = sizeof(Record) + format_size;
+  const uint32_t record_size = (args_offset + args_size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+  // Anything larger could wait forever for a contiguous block
+  if (record_size > this->size_ / 2) {
+    this->dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  // Reserve the record, plus padding to skip the end of the ring if it doesn't fit there
+  uint32_t head = this->head_.load(std::memory_order_relaxed);
+  uint32_t padding;
+  do {
+    const uint32_t contiguous = this->size_ - (head & this->mask_);
+    padding = contiguous < record_size ? contiguous : 0;
+    if (head + padding + record_size - this->tail_.load(std::memory_order_acquire) > this->size_) {
+      this->dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  } while (!this->head_.compare_exchange_weak(head, head + padding + record_size, std::memory_order_relaxed));
+
+  if (padding != 0) {
+    // Records are aligned, so there's always room for the size and committed fields
+    auto *pad = reinterpret_cast<Record *>(this->at_(head));
+    pad->size = 0;
+    pad->committed.store(true, std::memory_order_release);
+  }
+
+  uint8_t *data = this->at_(head + padding);
+  auto *record = reinterpret_cast<Record *>(data);
+  record->size = record_size;
+  record->level = level;
+  record->line = line;
+  record->args_offset = args_offset;
+  record->tag = tag;
+  strncpy(record->thread_name, thread_name != nullptr ? thread_name : "", sizeof(record->thread_name) - 1);
+  std::memcpy(data + sizeof(Record), format, format_size);
+  pack_log_args(format, args, data + args_offset);
+  record->committed.store(true, std::memory_order_release);
+  return true;
+}
+
+const LogRingBuffer::Record *LogRingBuffer::front() {
+  while (true) {
+    const uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+    auto *record = reinterpret_cast<Record *>(this->at_(tail));
+    // Released space is zeroed, so this is also false when the ring is empty
+    if (!record->committed.load(std::memory_order_acquire))
+      return nullptr;
+    if (record->size != 0)
+      return record;
+
+    const uint32_t padding = this->size_ - (tail & this->mask_);
+    std::memset(static_cast<void *>(record), 0, padding);
+    this->tail_.store(tail + padding, std::memory_order_release);
+  }
+}
+
+void LogRingBuffer::release(const Record *record) {
+  const uint32_t size = record->size;
+  std::memset(const_cast<void *>(static_cast<const void *>(record)), 0, size);
+  this->tail_.store(this->tail_.load(std::memory_order_relaxed) + size, std::memory_order_release);
+}
+
+size_t LogRingBuffer::format(const Record *record, char *buf, size_t size) {
+  const auto *data = reinterpret_cast<const uint8_t *>(record);
+  return format_log_args(reinterpret_cast<const char *>(data + sizeof(Record)), data + record->args_offset, buf, size);
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_RING_BUFFER
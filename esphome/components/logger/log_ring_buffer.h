@@ -0,0 +1,73 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_RING_BUFFER
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace logger {
+
+/** Lock-free multi-producer, single-consumer queue of log messages that are formatted when they're taken out.
+ *
+ * Producers don't format anything: they store the level, tag and line, a copy of the format string and the
+ * arguments packed by type (strings are copied, everything else is stored by value). The consumer later prints the
+ * message conversion by conversion with format().
+ *
+ * Messages are stored back to back in a byte ring. A producer reserves room for its record by advancing the head
+ * with a compare-and-swap, fills it in and then marks it as committed, so several tasks can push at the same time.
+ * The consumer takes committed records in order and clears them before handing the room back. Messages that don't
+ * fit are dropped and counted.
+ */
+class LogRingBuffer {
+ public:
+  struct Record {
+    /// Size of the whole record including the packed data, 0 for the padding that skips to the start of the ring.
+    uint16_t size;
+    std::atomic<bool> committed;
+    uint8_t level;
+    uint16_t line;
+    /// Offset of the packed arguments from the start of the record, the format string comes before them.
+    uint16_t args_offset;
+    const char *tag;
+    char thread_name[16];
+  };
+
+  /// Create a buffer of at least \p size bytes (rounded up to a power of two).
+  explicit LogRingBuffer(size_t size);
+
+  /// Queue a message, returns false if it was dropped.
+  bool push(int level, const char *tag, int line, const char *thread_name, const char *format, va_list args);
+
+  /// The oldest committed message or nullptr if there is none. Must be followed by release() before the next call.
+  const Record *front();
+  void release(const Record *record);
+
+  /// Print the message of \p record into \p buf (NUL terminated, like vsnprintf()) and return the characters written.
+  static size_t format(const Record *record, char *buf, size_t size);
+
+  /// Number of messages dropped since the last call.
+  uint32_t take_dropped() { return this->dropped_.exchange(0, std::memory_order_relaxed); }
+
+ protected:
+  uint8_t *at_(uint32_t position) { return this->buffer_.get() + (position & this->mask_); }
+
+  std::unique_ptr<uint8_t[]> buffer_;
+  uint32_t size_;
+  uint32_t mask_;
+  /// Total bytes ever reserved by producers.
+  std::atomic<uint32_t> head_{0};
+  /// Total bytes ever released by the consumer.
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint32_t> dropped_{0};
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_RING_BUFFER
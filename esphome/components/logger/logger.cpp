@@ -1,14 +1,25 @@
 #include "logger.h"
 #include <cinttypes>
 
+#include "log_args.h"
+
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 
+#if defined(USE_LOGGER_RING_BUFFER) && defined(USE_SOCKET_SELECT_SUPPORT)
+#include <cstring>
+#include <lwip/opt.h>
+#endif
+
 namespace esphome {
 namespace logger {
 
 static const char *const TAG = "logger";
+#if defined(USE_LOGGER_RING_BUFFER) && defined(USE_SOCKET_SELECT_SUPPORT)
+/// Name of the ESP-IDF WiFi driver task.
+static const char *const LOGGER_WIFI_TASK_NAME = "wifi";
+#endif
 
 static const char *const LOG_LEVEL_COLORS[] = {
     "",                                            // NONE
@@ -31,7 +42,7 @@ static const char *const LOG_LEVEL_LETTERS[] = {
     "VV",  // VERY_VERBOSE
 };
 
-void Logger::write_header_(int level, const char *tag, int line) {
+void Logger::write_header_(int level, const char *tag, int line, const char *thread_name) {
   if (level < 0)
     level = 0;
   if (level > 7)
@@ -39,35 +50,63 @@ void Logger::write_header_(int level, const char *tag, int line) {
 
   const char *color = LOG_LEVEL_COLORS[level];
   const char *letter = LOG_LEVEL_LETTERS[level];
-#if defined(USE_ESP32) || defined(USE_LIBRETINY)
-  TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
-#else
-  void *current_task = nullptr;
-#endif
-  if (current_task == main_task_) {
+  if (thread_name == nullptr) {
     this->printf_to_buffer_("%s[%s][%s:%03u]: ", color, letter, tag, line);
   } else {
-    const char *thread_name = "";
-#if defined(USE_ESP32)
-    thread_name = pcTaskGetName(current_task);
-#elif defined(USE_LIBRETINY)
-    thread_name = pcTaskGetTaskName(current_task);
-#endif
     this->printf_to_buffer_("%s[%s][%s:%03u]%s[%s]%s: ", color, letter, tag, line,
                             ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), thread_name, color);
   }
 }
 
+const char *Logger::get_thread_name_() {
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
+  if (current_task == main_task_)
+    return nullptr;
+#if defined(USE_ESP32)
+  return pcTaskGetName(current_task);
+#else
+  return pcTaskGetTaskName(current_task);
+#endif
+#else
+  return nullptr;
+#endif
+}
+
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->level_for(tag))
+    return;
+
+  const char *thread_name = this->get_thread_name_();
+#ifdef USE_LOGGER_RING_BUFFER
+  // Other tasks only queue the message, loop() prints it from the main task
+  if (thread_name != nullptr && this->log_buffer_ != nullptr) {
+    if (this->log_buffer_->push(level, tag, line, thread_name, format, args)) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+      // Print it now rather than after the loop's sleep, waking it once for all messages queued until it prints them.
+      // Waking sends to a socket, which waits for lwIP's task, so lwIP and the WiFi driver (which lwIP waits for)
+      // leave their messages for the next loop iteration.
+      if (strcmp(thread_name, TCPIP_THREAD_NAME) != 0 && strcmp(thread_name, LOGGER_WIFI_TASK_NAME) != 0 &&
+          !this->wake_pending_.exchange(true))
+        App.wake_loop_threadsafe();
+#endif
+    }
+    return;
+  }
+#endif
+  if (recursion_guard_)
     return;
 
   recursion_guard_ = true;
   this->reset_buffer_();
-  this->write_header_(level, tag, line);
+  this->write_header_(level, tag, line, thread_name);
+  // The callbacks can't tell which task a message came from, those are only passed on as text
+  if (this->message_source_enabled_ && thread_name == nullptr)
+    this->set_message_source_(format, format, line, args);
   this->vprintf_to_buffer_(format, args);
   this->write_footer_();
   this->log_message_(level, tag);
+  this->message_source_ = nullptr;
   recursion_guard_ = false;
 }
 #ifdef USE_STORE_LOG_STR_IN_FLASH
@@ -93,10 +132,14 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
   uint32_t offset = this->tx_buffer_at_;
 
   // now apply vsnprintf
-  this->write_header_(level, tag, line);
+  const char *thread_name = this->get_thread_name_();
+  this->write_header_(level, tag, line, thread_name);
+  if (this->message_source_enabled_ && thread_name == nullptr)
+    this->set_message_source_(this->tx_buffer_, format, line, args);
   this->vprintf_to_buffer_(this->tx_buffer_, args);
   this->write_footer_();
   this->log_message_(level, tag, offset);
+  this->message_source_ = nullptr;
   recursion_guard_ = false;
 }
 #endif
@@ -148,9 +191,48 @@ Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate
 #endif
 }
 
-#ifdef USE_LOGGER_USB_CDC
+#ifdef USE_LOGGER_RING_BUFFER
+void Logger::init_log_buffer(size_t size) {
+  this->log_buffer_ = make_unique<LogRingBuffer>(size);
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  App.enable_loop_wakeup();
+#endif
+}
+
+void Logger::process_log_buffer_() {
+  if (this->log_buffer_ == nullptr)
+    return;
+
+  // cleared first, so messages queued from now on wake the loop again
+  this->wake_pending_.store(false);
+  const LogRingBuffer::Record *record;
+  while ((record = this->log_buffer_->front()) != nullptr) {
+    this->recursion_guard_ = true;
+    this->reset_buffer_();
+    this->write_header_(record->level, record->tag, record->line, record->thread_name);
+    if (!this->is_buffer_full_()) {
+      // the tx buffer has one more byte for the null terminator
+      this->tx_buffer_at_ += LogRingBuffer::format(record, this->tx_buffer_ + this->tx_buffer_at_,
+                                                   this->buffer_remaining_capacity_() + 1);
+    }
+    this->write_footer_();
+    this->log_message_(record->level, record->tag);
+    this->recursion_guard_ = false;
+    this->log_buffer_->release(record);
+  }
+
+  uint32_t dropped = this->log_buffer_->take_dropped();
+  if (dropped > 0)
+    ESP_LOGW(TAG, "Dropped %" PRIu32 " messages from other tasks, the log buffer was full", dropped);
+}
+#endif
+
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_RING_BUFFER)
 void Logger::loop() {
-#ifdef USE_ARDUINO
+#ifdef USE_LOGGER_RING_BUFFER
+  this->process_log_buffer_();
+#endif
+#if defined(USE_LOGGER_USB_CDC) && defined(USE_ARDUINO)
   if (this->uart_ != UART_SELECTION_USB_CDC) {
     return;
   }
@@ -175,7 +257,7 @@ void Logger::set_log_level(const std::string &tag, int log_level) {
 UARTSelection Logger::get_uart() const { return this->uart_; }
 #endif
 
-void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
+void Logger::add_on_log_callback(InlineFunction<void(int, const char *, const char *)> &&callback) {
   this->log_callback_.add(std::move(callback));
 }
 float Logger::get_setup_priority() const { return setup_priority::BUS + 500.0f; }
@@ -193,6 +275,19 @@ void Logger::dump_config() {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
 }
+void Logger::set_message_source_(const char *format, const void *site, int line, va_list args) {
+  va_list args_copy;
+  va_copy(args_copy, args);
+  const size_t args_size = pack_log_args(format, args_copy, nullptr);
+  va_end(args_copy);
+  this->packed_args_.resize(args_size);
+  va_copy(args_copy, args);
+  pack_log_args(format, args_copy, this->packed_args_.data());
+  va_end(args_copy);
+  this->message_source_storage_ = MessageSource{format, site, line, this->packed_args_.data(), args_size};
+  this->message_source_ = &this->message_source_storage_;
+}
+
 void Logger::write_footer_() { this->write_to_buffer_(ESPHOME_LOG_RESET_COLOR, strlen(ESPHOME_LOG_RESET_COLOR)); }
 
 Logger *global_logger = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdarg>
 #include <vector>
 #include "esphome/core/automation.h"
@@ -7,6 +8,10 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
+#ifdef USE_LOGGER_RING_BUFFER
+#include "log_ring_buffer.h"
+#endif
+
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
 #include <HardwareSerial.h>
@@ -56,8 +61,15 @@ enum UARTSelection {
 class Logger : public Component {
  public:
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
-#ifdef USE_LOGGER_USB_CDC
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_RING_BUFFER)
   void loop() override;
+#endif
+#ifdef USE_LOGGER_RING_BUFFER
+  /** Queue messages logged by other tasks in a buffer of \p size bytes instead of printing them right away.
+   *
+   * They're formatted and passed on to the serial port and the log callbacks by loop(), on the main task.
+   */
+  void init_log_buffer(size_t size);
 #endif
   /// Manually set the baud rate for serial, set to 0 to disable.
   void set_baud_rate(uint32_t baud_rate);
@@ -86,7 +98,22 @@ class Logger : public Component {
   int level_for(const char *tag);
 
   /// Register a callback that will be called for every log message sent
-  void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+  void add_on_log_callback(InlineFunction<void(int, const char *, const char *)> &&callback);
+
+  /// Format string, line and arguments (packed by pack_log_args()) of a log message.
+  struct MessageSource {
+    const char *format;
+    /// The format string as the call site passed it, in flash with USE_STORE_LOG_STR_IN_FLASH. Together with the tag
+    /// and line it identifies the call site, since its format string is a literal.
+    const void *site;
+    int line;
+    const uint8_t *args;
+    size_t args_size;
+  };
+  /// Make get_message_source() available to the log callbacks, which costs an extra pass over the arguments.
+  void enable_message_source() { this->message_source_enabled_ = true; }
+  /// Source of the message the log callbacks are being called for, nullptr if it isn't known.
+  const MessageSource *get_message_source() const { return this->message_source_; }
 
   float get_setup_priority() const override;
 
@@ -96,8 +123,16 @@ class Logger : public Component {
 #endif
 
  protected:
-  void write_header_(int level, const char *tag, int line);
+  /// Write the message header, \p thread_name is only shown for messages that didn't come from the main task.
+  void write_header_(int level, const char *tag, int line, const char *thread_name);
+  /// Name of the current task if it isn't the main task, otherwise nullptr.
+  const char *get_thread_name_();
+#ifdef USE_LOGGER_RING_BUFFER
+  void process_log_buffer_();
+#endif
   void write_footer_();
+  /// Pack \p args for get_message_source(), they're left untouched.
+  void set_message_source_(const char *format, const void *site, int line, va_list args);
   void log_message_(int level, const char *tag, int offset = 0);
   void write_msg_(const char *msg);
 
@@ -168,6 +203,15 @@ class Logger : public Component {
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
   void *main_task_ = nullptr;
+  bool message_source_enabled_{false};
+  MessageSource message_source_storage_{};
+  const MessageSource *message_source_{nullptr};
+  std::vector<uint8_t> packed_args_;
+#ifdef USE_LOGGER_RING_BUFFER
+  std::unique_ptr<LogRingBuffer> log_buffer_;
+  /// The loop was woken for queued messages and hasn't printed them yet, so pushes don't need to wake it again.
+  std::atomic<bool> wake_pending_{false};
+#endif
 };
 
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -3,6 +3,7 @@ import logging
 from esphome.automation import build_automation, register_action, validate_automation
 import esphome.codegen as cg
 from esphome.components.display import Display
+from esphome.components.image import CONF_COMPRESSION
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_AUTO_CLEAR_ENABLED,
@@ -200,6 +201,8 @@ def final_validation(configs):
                 raise cv.Invalid(
                     "Using RGBA or RGB24 in image config not compatible with LVGL", path
                 )
+            if image_conf.get(CONF_COMPRESSION, "NONE") != "NONE":
+                raise cv.Invalid("Compressed images are not compatible with LVGL", path)
         for w in focused_widgets:
             path = global_config.get_path_for_id(w)
             widget_conf = global_config.get_config_for_path(path[:-1])
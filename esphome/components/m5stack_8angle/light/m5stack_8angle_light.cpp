@@ -27,8 +27,11 @@ void M5Stack8AngleLightOutput::setup() {
 }
 
 void M5Stack8AngleLightOutput::write_state(light::LightState *state) {
-  for (int i = 0; i < M5STACK_8ANGLE_NUM_LEDS;
-       i++) {  // write one LED at a time, otherwise the message will be truncated
+  // every LED has its own registers, so only the ones that changed are written
+  int32_t from, to;
+  if (!this->take_dirty_range_(from, to))
+    return;
+  for (int i = from; i < to; i++) {  // write one LED at a time, otherwise the message will be truncated
     this->parent_->write_register(M5STACK_8ANGLE_REGISTER_RGB_24B + i * M5STACK_8ANGLE_BYTES_PER_LED,
                                   this->buf_ + i * M5STACK_8ANGLE_BYTES_PER_LED, M5STACK_8ANGLE_BYTES_PER_LED);
   }
@@ -82,6 +82,9 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
   void write_state(light::LightState *state) override {
+    int32_t from, to;
+    if (!this->take_dirty_range_(from, to))
+      return;
     this->mark_shown_();
     this->controller_->Dirty();
 
@@ -116,6 +119,15 @@ class NeoPixelRGBLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_COL
   }
 
  protected:
+  light::PixelBuffer get_pixel_buffer_() const override {
+    light::PixelBuffer buffer;
+    buffer.data = this->controller_->Pixels();
+    buffer.stride = 3;
+    buffer.red = this->rgb_offsets_[0];
+    buffer.green = this->rgb_offsets_[1];
+    buffer.blue = this->rgb_offsets_[2];
+    return buffer;
+  }
   light::ESPColorView get_view_internal(int32_t index) const override {  // NOLINT
     uint8_t *base = this->controller_->Pixels() + 3ULL * index;
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
@@ -133,6 +145,16 @@ class NeoPixelRGBWLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_CO
   }
 
  protected:
+  light::PixelBuffer get_pixel_buffer_() const override {
+    light::PixelBuffer buffer;
+    buffer.data = this->controller_->Pixels();
+    buffer.stride = 4;
+    buffer.red = this->rgb_offsets_[0];
+    buffer.green = this->rgb_offsets_[1];
+    buffer.blue = this->rgb_offsets_[2];
+    buffer.white = this->rgb_offsets_[3];
+    return buffer;
+  }
   light::ESPColorView get_view_internal(int32_t index) const override {  // NOLINT
     uint8_t *base = this->controller_->Pixels() + 4ULL * index;
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
@@ -13,7 +13,7 @@ void Number::publish_state(float state) {
   this->state_callback_.call(state);
 }
 
-void Number::add_on_state_callback(std::function<void(float)> &&callback) {
+void Number::add_on_state_callback(InlineFunction<void(float)> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 
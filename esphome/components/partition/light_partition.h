@@ -52,8 +52,13 @@ class PartitionLightOutput : public light::AddressableLight {
   }
   light::LightTraits get_traits() override { return this->segments_[0].get_src()->get_traits(); }
   void write_state(light::LightState *state) override {
-    for (auto seg : this->segments_) {
-      seg.get_src()->schedule_show();
+    int32_t from, to;
+    if (!this->take_dirty_range_(from, to))
+      return;
+    // only show the lights of the segments that changed, the LEDs were marked in them when they were written
+    for (auto &seg : this->segments_) {
+      if (seg.get_dst_offset() < to && seg.get_dst_offset() + seg.get_size() > from)
+        seg.get_src()->schedule_show();
     }
     this->mark_shown_();
   }
@@ -45,6 +45,7 @@ class PowerSupply : public Component {
 class PowerSupplyRequester {
  public:
   void set_parent(PowerSupply *parent) { parent_ = parent; }
+  bool has_parent() const { return this->parent_ != nullptr; }
   void request() {
     if (!this->requested_ && this->parent_ != nullptr) {
       this->parent_->request_high_power();
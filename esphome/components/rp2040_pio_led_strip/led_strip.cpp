@@ -150,6 +150,11 @@ void RP2040PIOLEDStripLightOutput::write_state(light::LightState *state) {
     return;
   }
 
+  // the whole strip has to be sent anyway, but there's no need to if nothing changed
+  int32_t from, to;
+  if (!this->take_dirty_range_(from, to))
+    return;
+
   // the bits are already in the correct order for the pio program so we can just copy the buffer using DMA
   sem_acquire_blocking(&RP2040PIOLEDStripLightOutput::dma_write_complete_sem_[this->dma_chan_]);
   dma_channel_transfer_from_buffer_now(this->dma_chan_, this->buf_, this->get_buffer_size_());
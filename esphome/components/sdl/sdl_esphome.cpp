@@ -2,9 +2,14 @@
 #include "sdl_esphome.h"
 #include "esphome/components/display/display_color_utils.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace sdl {
 
+/// Pixels converted at a time when drawing spans.
+static const int SPAN_CHUNK_PIXELS = 64;
+
 void Sdl::setup() {
   ESP_LOGD(TAG, "Starting setup");
   SDL_Init(SDL_INIT_VIDEO);
@@ -61,6 +66,43 @@ void Sdl::draw_pixel_at(int x, int y, Color color) {
     this->y_high_ = y;
 }
 
+void Sdl::fill_span(int x, int y, int width, Color color) {
+  int min_x, max_x;
+  if (!this->clamp_span_(x, y, width, min_x, max_x))
+    return;
+  uint16_t data[SPAN_CHUNK_PIXELS];
+  std::fill_n(data, SPAN_CHUNK_PIXELS, display::ColorUtil::color_to_565(color, display::COLOR_ORDER_RGB));
+  for (x = min_x; x < max_x; x += SPAN_CHUNK_PIXELS)
+    this->update_span_(x, y, std::min(max_x - x, SPAN_CHUNK_PIXELS), data);
+}
+
+void Sdl::blit_span(int x, int y, int width, const Color *colors) {
+  int min_x, max_x;
+  if (!this->clamp_span_(x, y, width, min_x, max_x))
+    return;
+  uint16_t data[SPAN_CHUNK_PIXELS];
+  colors += min_x - x;
+  for (x = min_x; x < max_x; x += SPAN_CHUNK_PIXELS) {
+    const int count = std::min(max_x - x, SPAN_CHUNK_PIXELS);
+    for (int i = 0; i != count; i++)
+      data[i] = display::ColorUtil::color_to_565(*colors++, display::COLOR_ORDER_RGB);
+    this->update_span_(x, y, count, data);
+  }
+}
+
+void Sdl::update_span_(int x, int y, int width, const uint16_t *data) {
+  SDL_Rect rect{x, y, width, 1};
+  SDL_UpdateTexture(this->texture_, &rect, data, width * 2);
+  if (x < this->x_low_)
+    this->x_low_ = x;
+  if (y < this->y_low_)
+    this->y_low_ = y;
+  if (x + width - 1 > this->x_high_)
+    this->x_high_ = x + width - 1;
+  if (y > this->y_high_)
+    this->y_high_ = y;
+}
+
 void Sdl::loop() {
   SDL_Event e;
   if (SDL_PollEvent(&e)) {
@@ -22,6 +22,8 @@ class Sdl : public display::Display {
   void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
                       display::ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) override;
   void draw_pixel_at(int x, int y, Color color) override;
+  void fill_span(int x, int y, int width, Color color) override;
+  void blit_span(int x, int y, int width, const Color *colors) override;
   void set_dimensions(uint16_t width, uint16_t height) {
     this->width_ = width;
     this->height_ = height;
@@ -39,6 +41,7 @@ class Sdl : public display::Display {
   int get_width_internal() override { return this->width_; }
   int get_height_internal() override { return this->height_; }
   void redraw_(SDL_Rect &rect);
+  void update_span_(int x, int y, int width, const uint16_t *data);
   int width_{};
   int height_{};
   SDL_Renderer *renderer_{};
@@ -59,7 +59,7 @@ class Select : public EntityBase {
   /// Return the (optional) option value at the provided index offset.
   optional<std::string> at(size_t index) const;
 
-  void add_on_state_callback(std::function<void(std::string, size_t)> &&callback);
+  void add_on_state_callback(InlineFunction<void(std::string, size_t)> &&callback);
 
  protected:
   friend class SelectCall;
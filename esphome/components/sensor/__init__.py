@@ -34,6 +34,7 @@ from esphome.const import (
     CONF_TO,
     CONF_TRIGGER_ID,
     CONF_TYPE,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_VALUE,
     CONF_WEB_SERVER,
@@ -92,9 +93,9 @@ from esphome.const import (
     DEVICE_CLASS_WIND_SPEED,
     ENTITY_CATEGORY_CONFIG,
 )
-from esphome.core import CORE, coroutine_with_priority
-from esphome.cpp_generator import MockObjClass
-from esphome.cpp_helpers import setup_entity
+from esphome.core import CORE, ID, coroutine_with_priority
+from esphome.cpp_generator import FloatLiteral, LambdaExpression, MockObjClass
+from esphome.cpp_helpers import extract_registry_entry_config, setup_entity
 from esphome.util import Registry
 
 CODEOWNERS = ["@esphome/core"]
@@ -251,6 +252,7 @@ SensorInRangeCondition = sensor_ns.class_("SensorInRangeCondition", Filter)
 ClampFilter = sensor_ns.class_("ClampFilter", Filter)
 RoundFilter = sensor_ns.class_("RoundFilter", Filter)
 RoundMultipleFilter = sensor_ns.class_("RoundMultipleFilter", Filter)
+StatelessFilter = sensor_ns.class_("StatelessFilter", Filter)
 
 validate_unit_of_measurement = cv.string_strict
 validate_accuracy_decimals = cv.int_
@@ -637,16 +639,17 @@ def validate_calibrate_linear(config):
     ),
 )
 async def calibrate_linear_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, _calibrate_linear_functions(config))
+
+
+def _calibrate_linear_functions(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
 
-    linear_functions = []
     if config[CONF_METHOD] == "least_squares":
         k, b = fit_linear(x, y)
-        linear_functions = [[k, b, float("NaN")]]
-    elif config[CONF_METHOD] == "exact":
-        linear_functions = map_linear(x, y)
-    return cg.new_Pvariable(filter_id, linear_functions)
+        return [[k, b, float("NaN")]]
+    return map_linear(x, y)
 
 
 CONF_DEGREE = "degree"
@@ -677,14 +680,17 @@ def validate_calibrate_polynomial(config):
     ),
 )
 async def calibrate_polynomial_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, _calibrate_polynomial_coefficients(config))
+
+
+def _calibrate_polynomial_coefficients(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
     degree = config[CONF_DEGREE]
     a = [[1] + [x_ ** (i + 1) for i in range(degree)] for x_ in x]
     # Column vector
     b = [[v] for v in y]
-    res = [v[0] for v in _lstsq(a, b)]
-    return cg.new_Pvariable(filter_id, res)
+    return [v[0] for v in _lstsq(a, b)]
 
 
 def validate_clamp(config):
@@ -757,6 +763,131 @@ async def build_filters(config):
     return await cg.build_registry_list(FILTER_REGISTRY, config)
 
 
+def _stateless_filter_steps(name, config):
+    """The C++ statements of a filter that keeps no state between values, None for others.
+
+    The statements change ``x`` (or return to stop the chain) with the same float
+    operations as the filter class, so the fused chain gives exactly the same results.
+    """
+    if name == "offset":
+        # Same operation as OffsetFilter::new_value()
+        return [f"x = x + {FloatLiteral(config)};"]
+    if name == "multiply":
+        # Same operation as MultiplyFilter::new_value()
+        return [f"x = x * {FloatLiteral(config)};"]
+    if name == "calibrate_linear":
+        return [_calibrate_linear_code(_calibrate_linear_functions(config))]
+    if name == "calibrate_polynomial":
+        coefficients = _calibrate_polynomial_coefficients(config)
+        # Same operations as CalibratePolynomialFilter::new_value()
+        code = "  const float value = x;\n  float power = 1.0f;\n  x = 0.0f;\n"
+        code += "".join(
+            f"  x += power * {FloatLiteral(c)};\n  power *= value;\n"
+            for c in coefficients
+        )
+        return [f"{{\n{code}}}"]
+    if name == "clamp":
+        return [_clamp_code(config)]
+    if name == "round":
+        decimals = config[CONF_ACCURACY_DECIMALS]
+        return [
+            "if (std::isfinite(x)) {\n"
+            f"  const float accuracy_mult = powf(10.0f, {decimals});\n"
+            "  x = roundf(accuracy_mult * x) / accuracy_mult;\n"
+            "}"
+        ]
+    if name == "round_to_multiple_of":
+        return [
+            "if (std::isfinite(x)) {\n"
+            f"  x = x - remainderf(x, {FloatLiteral(config[CONF_MULTIPLE])});\n"
+            "}"
+        ]
+    return None
+
+
+def _if_chain(branches):
+    """Print (condition, statement) pairs as if/else if/else, None is the else."""
+    code = ""
+    for condition, statement in branches:
+        if condition is None:
+            if not code:
+                return statement
+            return f"{code}}} else {{\n  {statement}\n}}"
+        code += f"{'} else ' if code else ''}if ({condition}) {{\n  {statement}\n"
+    return f"{code}}}"
+
+
+def _calibrate_linear_code(functions):
+    # Same search as CalibrateLinearFilter::new_value()
+    branches = []
+    for k, b, until in functions:
+        statement = f"x = x * {FloatLiteral(k)} + {FloatLiteral(b)};"
+        if not math.isfinite(until):
+            return _if_chain(branches + [(None, statement)])
+        branches.append((f"x < {FloatLiteral(until)}", statement))
+    return _if_chain(branches + [(None, "x = NAN;")])
+
+
+def _clamp_code(config):
+    # Same checks as ClampFilter::new_value()
+    branches = []
+    for key, compare in ((CONF_MIN_VALUE, "<"), (CONF_MAX_VALUE, ">")):
+        if not math.isfinite(limit := config[key]):
+            continue
+        limit = FloatLiteral(limit)
+        if config[CONF_IGNORE_OUT_OF_RANGE]:
+            branches.append((f"x {compare} {limit}", "return {};"))
+        else:
+            branches.append((f"x {compare} {limit}", f"x = {limit};"))
+    checks = "".join(f"  {line}\n" for line in _if_chain(branches).splitlines())
+    return f"if (std::isfinite(x)) {{\n{checks}}}"
+
+
+def _stateless_filter_code(steps):
+    """Print the steps as one function body."""
+    return "".join(f"{step}\n" for step in steps) + "return x;"
+
+
+async def build_sensor_filters(config):
+    """Build the filter chain of a sensor.
+
+    Runs of two or more stateless filters (offset, multiply, calibrate_linear, ...)
+    become a single StatelessFilter that runs them all in one generated function,
+    stateful filters are built like build_filters() does.
+    """
+    filters = []
+    run = []
+
+    async def flush_run():
+        if len(run) == 1:
+            filters.append(await cg.build_registry_entry(FILTER_REGISTRY, run[0][0]))
+        elif run:
+            steps = [step for _, run_steps in run for step in run_steps]
+            function = LambdaExpression(
+                _stateless_filter_code(steps),
+                [(float, "x")],
+                capture="",
+                return_type=cg.optional.template(float),
+            )
+            first_id = run[0][0][CONF_TYPE_ID]
+            filter_id = ID(
+                f"{first_id.id}_stateless", is_declaration=True, type=StatelessFilter
+            )
+            filters.append(cg.new_Pvariable(filter_id, function))
+        run.clear()
+
+    for conf in config:
+        entry, entry_config = extract_registry_entry_config(FILTER_REGISTRY, conf)
+        steps = _stateless_filter_steps(entry.name, entry_config)
+        if steps is None:
+            await flush_run()
+            filters.append(await cg.build_registry_entry(FILTER_REGISTRY, conf))
+        else:
+            run.append((conf, steps))
+    await flush_run()
+    return filters
+
+
 async def setup_sensor_core_(var, config):
     await setup_entity(var, config)
 
@@ -770,7 +901,7 @@ async def setup_sensor_core_(var, config):
         cg.add(var.set_accuracy_decimals(accuracy_decimals))
     cg.add(var.set_force_update(config[CONF_FORCE_UPDATE]))
     if config.get(CONF_FILTERS):  # must exist and not be empty
-        filters = await build_filters(config[CONF_FILTERS])
+        filters = await build_sensor_filters(config[CONF_FILTERS])
         cg.add(var.set_filters(filters))
 
     for conf in config.get(CONF_ON_VALUE, []):
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cmath>
+#include <functional>
 #include <queue>
 #include <utility>
 #include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
+#include "sliding_window.h"
 
 namespace esphome {
 namespace sensor {
@@ -29,6 +32,17 @@ class Filter {
    */
   virtual optional<float> new_value(float value) = 0;
 
+  /** Batch version of new_value() used by Sensor::publish_samples().
+   *
+   * Filters the values in place: the ones that should be passed down the chain are moved to the front, in order,
+   * and their number is returned. The default calls new_value() for each value.
+   *
+   * @param values The new values, oldest first.
+   * @param count The number of values.
+   * @return The number of values left at the start of values.
+   */
+  virtual size_t new_values(float *values, size_t count);
+
   /// Initialize this filter, please note this can be called more than once.
   virtual void initialize(Sensor *parent, Filter *next);
 
@@ -36,6 +50,9 @@ class Filter {
 
   void output(float value);
 
+  /// Like input() for several values, the ones left after new_values() go down the chain as one batch.
+  void input_values(float *values, size_t count);
+
  protected:
   friend Sensor;
 
@@ -67,10 +84,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedSlidingWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -96,10 +112,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedSlidingWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple skip filter.
@@ -142,10 +157,9 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SlidingWindowExtremum<std::less<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -170,10 +184,9 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SlidingWindowExtremum<std::greater<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
@@ -199,10 +212,24 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  /// Add \p value to the running sum, keeping track of the rounding error so it doesn't pile up.
+  void add_to_sum_(float value);
+  /// Count \p value as part of the window unless it's NaN.
+  void add_value_(float value);
+  /// Sum up the window again, needed when the running sum isn't finite anymore.
+  void recalculate_sum_();
+
+  /// The values in the order they were added, as a ring starting at oldest_.
+  std::vector<float> values_;
+  size_t oldest_{0};
+  size_t window_size_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
+  float sum_{0.0f};
+  /// What rounding took off sum_, the sum is sum_ + compensation_.
+  float compensation_{0.0f};
+  /// Number of values in the window that aren't NaN.
+  size_t valid_count_{0};
 };
 
 /** Simple exponential moving average filter.
@@ -270,12 +297,32 @@ class LambdaFilter : public Filter {
   lambda_filter_t lambda_filter_;
 };
 
+/** Several filters that don't keep any state (offset, multiply, calibrate_linear, clamp, ...) in a row.
+ *
+ * Codegen merges them into one function, so the whole run takes a single step of the filter chain. Every filter keeps
+ * its own float operations, so the results are the same as with separate filters. The function is a plain pointer to
+ * keep the filter small.
+ */
+class StatelessFilter : public Filter {
+ public:
+  using stateless_filter_t = optional<float> (*)(float);
+
+  explicit StatelessFilter(stateless_filter_t stateless_filter) : stateless_filter_(stateless_filter) {}
+
+  optional<float> new_value(float value) override { return this->stateless_filter_(value); }
+  size_t new_values(float *values, size_t count) override;
+
+ protected:
+  stateless_filter_t stateless_filter_;
+};
+
 /// A simple filter that adds `offset` to each value it receives.
 class OffsetFilter : public Filter {
  public:
   explicit OffsetFilter(float offset);
 
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   float offset_;
@@ -287,6 +334,7 @@ class MultiplyFilter : public Filter {
   explicit MultiplyFilter(float multiplier);
 
   optional<float> new_value(float value) override;
+  size_t new_values(float *values, size_t count) override;
 
  protected:
   float multiplier_;
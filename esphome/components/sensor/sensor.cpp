@@ -1,4 +1,5 @@
 #include "sensor.h"
+#include <algorithm>
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -6,6 +7,9 @@ namespace sensor {
 
 static const char *const TAG = "sensor";
 
+/// Samples passed through the filter chain at a time by publish_samples().
+static const size_t SAMPLES_BATCH_SIZE = 32;
+
 std::string state_class_to_string(StateClass state_class) {
   switch (state_class) {
     case STATE_CLASS_MEASUREMENT:
@@ -49,8 +53,29 @@ void Sensor::publish_state(float state) {
   }
 }
 
-void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
-void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
+void Sensor::publish_samples(const float *samples, size_t count) {
+  if (count == 0)
+    return;
+  if (this->filter_list_ == nullptr || this->raw_callback_.size() != 0) {
+    // Raw state callbacks must see each sample before its filtered value is published
+    for (size_t i = 0; i < count; i++)
+      this->publish_state(samples[i]);
+    return;
+  }
+
+  ESP_LOGV(TAG, "'%s': Received %u new states, last %f", this->name_.c_str(), (unsigned) count, samples[count - 1]);
+  // Filters work in place, so copy the samples over in batches
+  float batch[SAMPLES_BATCH_SIZE];
+  for (size_t offset = 0; offset < count; offset += SAMPLES_BATCH_SIZE) {
+    const size_t batch_size = std::min(count - offset, SAMPLES_BATCH_SIZE);
+    std::copy(samples + offset, samples + offset + batch_size, batch);
+    this->raw_state = batch[batch_size - 1];
+    this->filter_list_->input_values(batch, batch_size);
+  }
+}
+
+void Sensor::add_on_state_callback(InlineFunction<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
+void Sensor::add_on_raw_state_callback(InlineFunction<void(float)> &&callback) {
   this->raw_callback_.add(std::move(callback));
 }
 
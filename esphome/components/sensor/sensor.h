@@ -114,12 +114,26 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
    */
   void publish_state(float state);
 
+  /** Publish several new states at once, oldest first.
+   *
+   * Does the same as calling publish_state() for each sample, but the samples go through the filter chain in
+   * batches, so filters that reduce them (like sliding_window_moving_average with send_every) can take a whole
+   * batch at a time and only the values that come out at the end reach the front-end. Meant for sensors that
+   * sample far more often than they report. If raw state callbacks are registered, each sample is published on
+   * its own instead, so they run in order with the filtered values. While a batch is filtered, .raw_state holds its
+   * last sample.
+   *
+   * @param samples The states, the last one ends up in .raw_state.
+   * @param count The number of states.
+   */
+  void publish_samples(const float *samples, size_t count);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Add a callback that will be called every time a filtered value arrives.
-  void add_on_state_callback(std::function<void(float)> &&callback);
+  void add_on_state_callback(InlineFunction<void(float)> &&callback);
   /// Add a callback that will be called every time the sensor sends a raw value.
-  void add_on_raw_state_callback(std::function<void(float)> &&callback);
+  void add_on_raw_state_callback(InlineFunction<void(float)> &&callback);
 
   /** This member variable stores the last state that has passed through all filters.
    *
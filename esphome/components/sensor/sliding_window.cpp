@@ -0,0 +1,72 @@
+#include "sliding_window.h"
+#include <algorithm>
+
+namespace esphome {
+namespace sensor {
+
+SortedSlidingWindow::SortedSlidingWindow(size_t window_size) : window_size_(window_size) {
+  this->values_.reserve(window_size);
+  this->sorted_.reserve(window_size);
+}
+void SortedSlidingWindow::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->values_.reserve(window_size);
+  this->sorted_.reserve(window_size);
+}
+void SortedSlidingWindow::push(float value) {
+  if (this->window_size_ == 0)
+    return;
+  // The window size changed since the last value: drop what doesn't fit anymore, or make room at the end
+  if (this->values_.size() > this->window_size_ || (this->oldest_ != 0 && this->values_.size() < this->window_size_))
+    this->reorder_();
+  if (this->values_.size() < this->window_size_) {
+    this->values_.push_back(value);
+  } else {
+    float &oldest = this->values_[this->oldest_];
+    if (!std::isnan(oldest))
+      this->erase_sorted_(oldest);
+    oldest = value;
+    if (++this->oldest_ == this->values_.size())
+      this->oldest_ = 0;
+  }
+  if (!std::isnan(value))
+    this->insert_sorted_(value);
+}
+void SortedSlidingWindow::reorder_() {
+  std::rotate(this->values_.begin(), this->values_.begin() + this->oldest_, this->values_.end());
+  this->oldest_ = 0;
+  if (this->values_.size() > this->window_size_) {
+    const size_t excess = this->values_.size() - this->window_size_;
+    for (size_t i = 0; i < excess; i++) {
+      if (!std::isnan(this->values_[i]))
+        this->erase_sorted_(this->values_[i]);
+    }
+    this->values_.erase(this->values_.begin(), this->values_.begin() + excess);
+  }
+}
+void SortedSlidingWindow::insert_sorted_(float value) {
+  this->sorted_.insert(std::upper_bound(this->sorted_.begin(), this->sorted_.end(), value), value);
+}
+void SortedSlidingWindow::erase_sorted_(float value) {
+  auto it = std::lower_bound(this->sorted_.begin(), this->sorted_.end(), value);
+  if (it != this->sorted_.end())
+    this->sorted_.erase(it);
+}
+float SortedSlidingWindow::median() const {
+  const size_t count = this->sorted_.size();
+  if (count == 0)
+    return NAN;
+  if (count % 2)
+    return this->sorted_[count / 2];
+  return (this->sorted_[count / 2] + this->sorted_[(count / 2) - 1]) / 2.0f;
+}
+float SortedSlidingWindow::quantile(float quantile) const {
+  const size_t count = this->sorted_.size();
+  if (count == 0)
+    return NAN;
+  const float position = ceilf(count * quantile);
+  return this->sorted_[position < 1.0f ? 0 : std::min(static_cast<size_t>(position), count) - 1];
+}
+
+}  // namespace sensor
+}  // namespace esphome
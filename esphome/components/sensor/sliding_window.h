@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace sensor {
+
+/** Sliding window over the last values that also keeps the values that aren't NaN in sorted order.
+ *
+ * Storage for both is allocated once for the window size. Adding a value finds where it goes (and where the value it
+ * replaces was) with a binary search and moves the values after it over by one, so the median or any quantile can be
+ * read right away instead of sorting a copy of the window every time.
+ */
+class SortedSlidingWindow {
+ public:
+  explicit SortedSlidingWindow(size_t window_size);
+
+  /// Change the number of values kept. Like the deque the filters used before, the oldest values are only dropped by
+  /// the next push(), so growing the window again before that keeps them.
+  void set_window_size(size_t window_size);
+  /// Add a value, replacing the oldest one if the window is full.
+  void push(float value);
+
+  /// Number of values in the window that aren't NaN.
+  size_t valid_count() const { return this->sorted_.size(); }
+  /// Median of the values that aren't NaN, NaN if there are none.
+  float median() const;
+  /// The \p quantile (0-1) of the values that aren't NaN, NaN if there are none.
+  float quantile(float quantile) const;
+
+ protected:
+  /// Put values_ in order, oldest first, and drop the oldest ones that don't fit into the window.
+  void reorder_();
+  void insert_sorted_(float value);
+  void erase_sorted_(float value);
+
+  /// The values in the order they were added, as a ring starting at oldest_.
+  std::vector<float> values_;
+  size_t oldest_{0};
+  size_t window_size_;
+  std::vector<float> sorted_;
+};
+
+/** Minimum or maximum of the last values that aren't NaN, in amortized constant time per value.
+ *
+ * Only the values that can still become the extremum are kept: a new value removes all older ones that are worse
+ * (they'd leave the window before it), so what's left is ordered and the extremum is the oldest entry. Storage is a
+ * ring allocated once for the window size.
+ *
+ * @tparam Compare std::less<float> for the minimum, std::greater<float> for the maximum.
+ */
+template<typename Compare> class SlidingWindowExtremum {
+ public:
+  explicit SlidingWindowExtremum(size_t window_size) : window_size_(window_size) {
+    this->entries_.resize(window_size);
+  }
+
+  /// Change the number of values considered. The values that don't fit anymore are dropped by the next push(), like
+  /// with SortedSlidingWindow.
+  void set_window_size(size_t window_size) {
+    std::vector<Entry> entries(this->count_ > window_size ? this->count_ : window_size);
+    for (size_t i = 0; i < this->count_; i++)
+      entries[i] = this->at_(i);
+    this->entries_ = std::move(entries);
+    this->first_ = 0;
+    this->window_size_ = window_size;
+  }
+
+  /// Add a value, the oldest one leaves the window if it's full.
+  void push(float value) {
+    if (this->window_size_ == 0)
+      return;
+    const uint32_t sequence = this->sequence_++;
+    this->expire_(this->window_size_);
+    if (std::isnan(value))
+      return;
+    while (this->count_ > 0 && !Compare()(this->at_(this->count_ - 1).value, value))
+      this->count_--;
+    this->at_(this->count_++) = Entry{value, sequence};
+  }
+
+  /// The extremum of the window, NaN if there are only NaN values in it.
+  float value() const { return this->count_ == 0 ? NAN : this->entries_[this->first_].value; }
+
+ protected:
+  struct Entry {
+    float value;
+    /// Which push() added this value.
+    uint32_t sequence;
+  };
+
+  Entry &at_(size_t index) {
+    index += this->first_;
+    return this->entries_[index >= this->entries_.size() ? index - this->entries_.size() : index];
+  }
+  /// Drop the entries that are older than the last \p window_size values.
+  void expire_(size_t window_size) {
+    while (this->count_ > 0 && this->sequence_ - this->entries_[this->first_].sequence > window_size) {
+      if (++this->first_ == this->entries_.size())
+        this->first_ = 0;
+      this->count_--;
+    }
+  }
+
+  std::vector<Entry> entries_;
+  size_t first_{0};
+  size_t count_{0};
+  size_t window_size_;
+  uint32_t sequence_{0};
+};
+
+}  // namespace sensor
+}  // namespace esphome
@@ -1,6 +1,9 @@
 #include "socket.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include "esphome/core/application.h"
+#endif
 
 #ifdef USE_SOCKET_IMPL_BSD_SOCKETS
 
@@ -40,7 +43,12 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
 
 class BSDSocketImpl : public Socket {
  public:
-  BSDSocketImpl(int fd) : fd_(fd) {}
+  BSDSocketImpl(int fd, bool loop_monitored = false) : fd_(fd) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (loop_monitored)
+      this->loop_monitored_ = App.register_socket_fd(fd);
+#endif
+  }
   ~BSDSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -50,10 +58,16 @@ class BSDSocketImpl : public Socket {
     int fd = ::accept(fd_, addr, addrlen);
     if (fd == -1)
       return {};
-    return make_unique<BSDSocketImpl>(fd);
+    return make_unique<BSDSocketImpl>(fd, this->loop_monitored_);
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return ::bind(fd_, addr, addrlen); }
   int close() override {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (this->loop_monitored_) {
+      App.unregister_socket_fd(fd_);
+      this->loop_monitored_ = false;
+    }
+#endif
     int ret = ::close(fd_);
     closed_ = true;
     return ret;
@@ -125,9 +139,15 @@ class BSDSocketImpl : public Socket {
     return 0;
   }
 
+  int get_fd() const override { return fd_; }
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  bool ready() const override { return !this->loop_monitored_ || App.is_socket_ready(fd_); }
+#endif
+
  protected:
   int fd_;
   bool closed_ = false;
+  bool loop_monitored_ = false;
 };
 
 std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
@@ -137,6 +157,15 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{new BSDSocketImpl(ret)};
 }
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol) {
+  int ret = ::socket(domain, type, protocol);
+  if (ret == -1)
+    return nullptr;
+  return std::unique_ptr<Socket>{new BSDSocketImpl(ret, true)};
+}
+#endif
+
 }  // namespace socket
 }  // namespace esphome
 
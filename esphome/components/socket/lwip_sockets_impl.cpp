@@ -1,6 +1,9 @@
 #include "socket.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include "esphome/core/application.h"
+#endif
 
 #ifdef USE_SOCKET_IMPL_LWIP_SOCKETS
 
@@ -33,7 +36,12 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
 
 class LwIPSocketImpl : public Socket {
  public:
-  LwIPSocketImpl(int fd) : fd_(fd) {}
+  LwIPSocketImpl(int fd, bool loop_monitored = false) : fd_(fd) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (loop_monitored)
+      this->loop_monitored_ = App.register_socket_fd(fd);
+#endif
+  }
   ~LwIPSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -43,10 +51,16 @@ class LwIPSocketImpl : public Socket {
     int fd = lwip_accept(fd_, addr, addrlen);
     if (fd == -1)
       return {};
-    return make_unique<LwIPSocketImpl>(fd);
+    return make_unique<LwIPSocketImpl>(fd, this->loop_monitored_);
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return lwip_bind(fd_, addr, addrlen); }
   int close() override {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+    if (this->loop_monitored_) {
+      App.unregister_socket_fd(fd_);
+      this->loop_monitored_ = false;
+    }
+#endif
     int ret = lwip_close(fd_);
     closed_ = true;
     return ret;
@@ -97,9 +111,15 @@ class LwIPSocketImpl : public Socket {
     return 0;
   }
 
+  int get_fd() const override { return fd_; }
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  bool ready() const override { return !this->loop_monitored_ || App.is_socket_ready(fd_); }
+#endif
+
  protected:
   int fd_;
   bool closed_ = false;
+  bool loop_monitored_ = false;
 };
 
 std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
@@ -109,6 +129,15 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
   return std::unique_ptr<Socket>{new LwIPSocketImpl(ret)};
 }
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol) {
+  int ret = lwip_socket(domain, type, protocol);
+  if (ret == -1)
+    return nullptr;
+  return std::unique_ptr<Socket>{new LwIPSocketImpl(ret, true)};
+}
+#endif
+
 }  // namespace socket
 }  // namespace esphome
 
@@ -42,6 +42,16 @@ class Socket {
 
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /// Get the underlying file descriptor, or -1 if the implementation doesn't use them.
+  virtual int get_fd() const { return -1; }
+
+  /** Whether reading from (or accepting on) this socket might not block.
+   *
+   * For sockets monitored by the main loop this is false until the loop has seen data arrive, so components can
+   * skip the read() syscall entirely. Other sockets always report true.
+   */
+  virtual bool ready() const { return true; }
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -50,6 +60,16 @@ std::unique_ptr<Socket> socket(int domain, int type, int protocol);
 /// Create a socket in the newest available IP domain (IPv6 or IPv4) of the given type and protocol.
 std::unique_ptr<Socket> socket_ip(int type, int protocol);
 
+/** Create a socket that is monitored by the main loop, which then wakes up as soon as data arrives on it.
+ *
+ * Sockets accepted from a monitored socket are monitored too. Must be created and closed from the main loop. Falls
+ * back to an unmonitored socket on implementations without select() support.
+ */
+std::unique_ptr<Socket> socket_loop_monitored(int domain, int type, int protocol);
+
+/// Like socket_ip(), but monitored by the main loop like socket_loop_monitored().
+std::unique_ptr<Socket> socket_ip_loop_monitored(int type, int protocol);
+
 /// Set a sockaddr to the specified address and port for the IP version used by socket_ip().
 socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::string &ip_address, uint16_t port);
 
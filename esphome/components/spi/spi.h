@@ -240,6 +240,18 @@ class SPIDelegate {
       ptr[i] = this->transfer(0);
   }
 
+  /**
+   * Start writing a buffer without waiting for it to be sent. The buffer must stay unchanged until
+   * get_queued_writes() no longer counts it. Delegates that can't queue write it right away.
+   */
+  virtual void queue_write_array(const uint8_t *ptr, size_t length) { this->write_array(ptr, length); }
+
+  /**
+   * Collect the queued writes that finished and return how many are still being sent.
+   * @param wait_one If some are being sent, wait until one of them finishes first.
+   */
+  virtual size_t get_queued_writes(bool wait_one) { return 0; }
+
   // check if device is ready
   virtual bool is_ready();
 
@@ -466,6 +478,18 @@ class SPIDevice : public SPIClient {
 
   void write_array(const uint8_t *data, size_t length) { this->delegate_->write_array(data, length); }
 
+  /// Write \p data in the background where the bus supports it, see SPIDelegate::queue_write_array().
+  void queue_write_array(const uint8_t *data, size_t length) { this->delegate_->queue_write_array(data, length); }
+
+  /// Number of queued writes that are still being sent.
+  size_t get_queued_writes() { return this->delegate_->get_queued_writes(false); }
+
+  /// Wait until at most \p max_pending queued writes are still being sent.
+  void wait_queued_writes(size_t max_pending = 0) {
+    while (this->delegate_->get_queued_writes(true) > max_pending) {
+    }
+  }
+
   template<size_t N> void write_array(const std::array<uint8_t, N> &data) { this->write_array(data.data(), N); }
 
   void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
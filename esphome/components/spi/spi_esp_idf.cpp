@@ -7,6 +7,7 @@ namespace spi {
 #ifdef USE_ESP_IDF
 static const char *const TAG = "spi-esp-idf";
 static const size_t MAX_TRANSFER_SIZE = 4092;  // dictated by ESP-IDF API.
+static const size_t QUEUE_SIZE = 2;            // writes that can be queued with queue_write_array()
 
 class SPIDelegateHw : public SPIDelegate {
  public:
@@ -18,7 +19,7 @@ class SPIDelegateHw : public SPIDelegate {
     config.clock_speed_hz = static_cast<int>(data_rate);
     config.spics_io_num = -1;
     config.flags = 0;
-    config.queue_size = 1;
+    config.queue_size = QUEUE_SIZE;
     config.pre_cb = nullptr;
     config.post_cb = nullptr;
     if (bit_order == BIT_ORDER_LSB_FIRST)
@@ -44,12 +45,14 @@ class SPIDelegateHw : public SPIDelegate {
 
   void end_transaction() override {
     if (this->is_ready()) {
+      this->wait_queued_();
       SPIDelegate::end_transaction();
       spi_device_release_bus(this->handle_);
     }
   }
 
   ~SPIDelegateHw() override {
+    this->wait_queued_();
     esp_err_t const err = spi_bus_remove_device(this->handle_);
     if (err != ESP_OK)
       ESP_LOGE(TAG, "Remove device failed - err %X", err);
@@ -64,6 +67,8 @@ class SPIDelegateHw : public SPIDelegate {
       ESP_LOGE(TAG, "Attempted read from write-only channel");
       return;
     }
+    // polling transactions can't start while queued ones are pending
+    this->wait_queued_();
     spi_transaction_t desc = {};
     desc.flags = 0;
     while (length != 0) {
@@ -90,6 +95,7 @@ class SPIDelegateHw : public SPIDelegate {
   }
 
   void write(uint16_t data, size_t num_bits) override {
+    this->wait_queued_();
     spi_transaction_ext_t desc = {};
     desc.command_bits = num_bits;
     desc.base.flags = SPI_TRANS_VARIABLE_CMD;
@@ -121,6 +127,7 @@ class SPIDelegateHw : public SPIDelegate {
       esph_log_w(TAG, "Nothing to transfer");
       return;
     }
+    this->wait_queued_();
     desc.base.flags = SPI_TRANS_VARIABLE_ADDR | SPI_TRANS_VARIABLE_CMD | SPI_TRANS_VARIABLE_DUMMY;
     if (bus_width == 4) {
       desc.base.flags |= SPI_TRANS_MODE_QIO;
@@ -188,10 +195,63 @@ class SPIDelegateHw : public SPIDelegate {
 
   void read_array(uint8_t *ptr, size_t length) override { this->transfer(nullptr, ptr, length); }
 
+  // queue interrupt transfers using the descriptors in turn, the caller keeps the data valid until they're collected
+  void queue_write_array(const uint8_t *ptr, size_t length) override {
+    while (length != 0) {
+      if (this->queued_ == QUEUE_SIZE)
+        this->collect_queued_(portMAX_DELAY);
+      size_t const partial = std::min(length, MAX_TRANSFER_SIZE);
+      spi_transaction_t &desc = this->queue_[this->queue_next_];
+      desc = {};
+      desc.length = partial * 8;
+      desc.tx_buffer = ptr;
+      esp_err_t const err = spi_device_queue_trans(this->handle_, &desc, portMAX_DELAY);
+      if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Queueing transmit failed - err %X", err);
+        return;
+      }
+      this->queue_next_ = (this->queue_next_ + 1) % QUEUE_SIZE;
+      this->queued_++;
+      length -= partial;
+      ptr += partial;
+    }
+  }
+
+  size_t get_queued_writes(bool wait_one) override {
+    if (this->queued_ != 0 && wait_one)
+      this->collect_queued_(portMAX_DELAY);
+    while (this->queued_ != 0 && this->collect_queued_(0)) {
+    }
+    return this->queued_;
+  }
+
  protected:
+  // collect one finished queued transfer, false if none finished within ticks_to_wait
+  bool collect_queued_(TickType_t ticks_to_wait) {
+    spi_transaction_t *done;
+    esp_err_t const err = spi_device_get_trans_result(this->handle_, &done, ticks_to_wait);
+    if (err == ESP_ERR_TIMEOUT)
+      return false;
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Queued transmit failed - err %X", err);
+      this->queued_ = 0;
+      return false;
+    }
+    this->queued_--;
+    return true;
+  }
+
+  void wait_queued_() {
+    while (this->queued_ != 0 && this->collect_queued_(portMAX_DELAY)) {
+    }
+  }
+
   SPIInterface channel_{};
   spi_device_handle_t handle_{};
   bool write_only_{false};
+  spi_transaction_t queue_[QUEUE_SIZE]{};
+  size_t queue_next_{0};
+  size_t queued_{0};
 };
 
 class SPIBusHw : public SPIBus {
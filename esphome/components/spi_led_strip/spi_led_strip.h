@@ -56,6 +56,10 @@ class SpiLedStrip : public light::AddressableLight,
   void write_state(light::LightState *state) override {
     if (this->is_failed())
       return;
+    // the whole strip has to be clocked out anyway, but there's no need to if nothing changed
+    int32_t from, to;
+    if (!this->take_dirty_range_(from, to))
+      return;
     if (ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE) {
       char strbuf[49];
       size_t len = std::min(this->buffer_size_, (size_t) (sizeof(strbuf) - 1) / 3);
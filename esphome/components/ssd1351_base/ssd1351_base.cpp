@@ -9,7 +9,6 @@ static const char *const TAG = "ssd1351";
 
 static const uint16_t SSD1351_COLORMASK = 0xffff;
 static const uint8_t SSD1351_MAX_CONTRAST = 15;
-static const uint8_t SSD1351_BYTESPERPIXEL = 2;
 // SSD1351 commands
 static const uint8_t SSD1351_SETCOLUMN = 0x15;
 static const uint8_t SSD1351_SETROW = 0x75;
@@ -47,6 +46,10 @@ static const uint8_t SSD1351_HORIZSCROLL = 0x96;
 static const uint8_t SSD1351_STOPSCROLL = 0x9E;
 static const uint8_t SSD1351_STARTSCROLL = 0x9F;
 
+static const size_t MAX_FLUSH_RECTS = 4;
+// The seven command and data bytes of a window are delayed by 1ms each, 8MHz sends about this many pixels meanwhile
+static const uint32_t WINDOW_COST = 3500;
+
 void SSD1351::setup() {
   this->init_internal_(this->get_buffer_length_());
 
@@ -90,14 +93,19 @@ void SSD1351::setup() {
   this->turn_on();           // display ON
 }
 void SSD1351::display() {
-  this->command(SSD1351_SETCOLUMN);  // set column address
-  this->data(0x00);                  // set column start address
-  this->data(0x7F);                  // set column end address
-  this->command(SSD1351_SETROW);     // set row address
-  this->data(0x00);                  // set row start address
-  this->data(0x7F);                  // set last row
-  this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  display::Rect rects[MAX_FLUSH_RECTS];
+  const size_t count = this->dirty_regions_.take(rects, MAX_FLUSH_RECTS, WINDOW_COST);
+  for (size_t i = 0; i != count; i++) {
+    const display::Rect &rect = rects[i];
+    this->command(SSD1351_SETCOLUMN);  // set column address
+    this->data(rect.x);                // set column start address
+    this->data(rect.x2() - 1);         // set column end address
+    this->command(SSD1351_SETROW);     // set row address
+    this->data(rect.y);                // set row start address
+    this->data(rect.y2() - 1);         // set last row
+    this->command(SSD1351_WRITERAM);
+    this->write_display_data(rect);
+  }
 }
 void SSD1351::update() {
   this->do_update_();
@@ -156,18 +164,26 @@ void HOT SSD1351::draw_absolute_pixel_internal(int x, int y, Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   // where should the bits go in the big buffer array? math...
   uint16_t pos = (x + y * this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
-  this->buffer_[pos++] = (color565 >> 8) & 0xff;
-  this->buffer_[pos] = color565 & 0xff;
+  const uint8_t high = (color565 >> 8) & 0xff, low = color565 & 0xff;
+  if (this->buffer_[pos] == high && this->buffer_[pos + 1] == low)
+    return;
+  this->buffer_[pos++] = high;
+  this->buffer_[pos] = low;
+  this->dirty_regions_.mark(x, y);
 }
 void SSD1351::fill(Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
-  for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
-    if (i & 1) {
-      this->buffer_[i] = color565 & 0xff;
-    } else {
-      this->buffer_[i] = (color565 >> 8) & 0xff;
-    }
-  }
+  const uint8_t pixel[SSD1351_BYTESPERPIXEL] = {uint8_t((color565 >> 8) & 0xff), uint8_t(color565 & 0xff)};
+  this->fill_buffer_(pixel, SSD1351_BYTESPERPIXEL);
+}
+void HOT SSD1351::fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) {
+  const uint32_t color565 = display::ColorUtil::color_to_565(color);
+  const uint8_t pixel[SSD1351_BYTESPERPIXEL] = {uint8_t((color565 >> 8) & 0xff), uint8_t(color565 & 0xff)};
+  this->fill_buffer_span_(x, y, step_x, step_y, count, pixel, SSD1351_BYTESPERPIXEL);
+}
+void HOT SSD1351::blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors) {
+  this->blit_buffer_span_(x, y, step_x, step_y, count, colors, SSD1351_BYTESPERPIXEL,
+                          [](Color color) { return display::ColorUtil::color_to_565(color); });
 }
 void SSD1351::init_reset_() {
   if (this->reset_pin_ != nullptr) {
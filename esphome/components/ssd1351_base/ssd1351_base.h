@@ -7,6 +7,8 @@
 namespace esphome {
 namespace ssd1351_base {
 
+static const uint8_t SSD1351_BYTESPERPIXEL = 2;
+
 enum SSD1351Model {
   SSD1351_MODEL_128_96 = 0,
   SSD1351_MODEL_128_128,
@@ -16,6 +18,7 @@ class SSD1351 : public display::DisplayBuffer {
  public:
   void setup() override;
 
+  /// Send the parts of the buffer that changed since the last call.
   void display();
 
   void update() override;
@@ -36,10 +39,13 @@ class SSD1351 : public display::DisplayBuffer {
  protected:
   virtual void command(uint8_t value) = 0;
   virtual void data(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Send the pixels of \p rect, the display was already told where they go.
+  virtual void write_display_data(const display::Rect &rect) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) override;
+  void blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
@@ -53,7 +53,7 @@ void SPISSD1351::data(uint8_t value) {
     this->cs_->digital_write(true);
   this->disable();
 }
-void HOT SPISSD1351::write_display_data() {
+void HOT SPISSD1351::write_display_data(const display::Rect &rect) {
   if (this->cs_)
     this->cs_->digital_write(true);
   this->dc_pin_->digital_write(true);
@@ -61,7 +61,15 @@ void HOT SPISSD1351::write_display_data() {
     this->cs_->digital_write(false);
   delay(1);
   this->enable();
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  const size_t stride = this->get_width_internal() * ssd1351_base::SSD1351_BYTESPERPIXEL;
+  if (rect.w == this->get_width_internal()) {
+    this->write_array(this->buffer_ + rect.y * stride, rect.h * stride);
+  } else {
+    for (int y = rect.y; y < rect.y2(); y++) {
+      this->write_array(this->buffer_ + y * stride + rect.x * ssd1351_base::SSD1351_BYTESPERPIXEL,
+                        rect.w * ssd1351_base::SSD1351_BYTESPERPIXEL);
+    }
+  }
   if (this->cs_)
     this->cs_->digital_write(true);
   this->disable();
@@ -7,6 +7,9 @@ namespace esphome {
 namespace st7735 {
 
 static const uint8_t ST_CMD_DELAY = 0x80;  // special signifier for command lists
+static const size_t MAX_FLUSH_RECTS = 8;
+// CASET, RASET and RAMWR with their arguments, in pixels that could be sent in the same time
+static const uint32_t WINDOW_COST = 32;
 
 static const uint8_t ST77XX_NOP = 0x00;
 static const uint8_t ST77XX_SWRESET = 0x01;
@@ -307,6 +310,23 @@ size_t ST7735::get_buffer_length() {
   return size_t(this->get_width_internal()) * size_t(this->get_height_internal()) * 2;
 }
 
+void ST7735::fill(Color color) {
+  if (this->is_clipping()) {
+    Display::fill(color);
+    return;
+  }
+  uint8_t pixel[2];
+  if (this->eightbitcolor_) {
+    pixel[0] = display::ColorUtil::color_to_332(color);
+    this->fill_buffer_(pixel, 1);
+  } else {
+    const uint16_t color565 = display::ColorUtil::color_to_565(color);
+    pixel[0] = color565 >> 8;
+    pixel[1] = color565;
+    this->fill_buffer_(pixel, 2);
+  }
+}
+
 void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
@@ -314,12 +334,41 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     const uint32_t color332 = display::ColorUtil::color_to_332(color);
     uint16_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     const uint32_t color565 = display::ColorUtil::color_to_565(color);
     uint16_t pos = (x + y * this->get_width_internal()) * 2;
-    this->buffer_[pos++] = (color565 >> 8) & 0xff;
-    this->buffer_[pos] = color565 & 0xff;
+    const uint8_t high = color565 >> 8, low = color565;
+    if (this->buffer_[pos] == high && this->buffer_[pos + 1] == low)
+      return;
+    this->buffer_[pos++] = high;
+    this->buffer_[pos] = low;
+  }
+  this->dirty_regions_.mark(x, y);
+}
+
+void HOT ST7735::fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) {
+  uint8_t pixel[2];
+  if (this->eightbitcolor_) {
+    pixel[0] = display::ColorUtil::color_to_332(color);
+    this->fill_buffer_span_(x, y, step_x, step_y, count, pixel, 1);
+  } else {
+    const uint16_t color565 = display::ColorUtil::color_to_565(color);
+    pixel[0] = color565 >> 8;
+    pixel[1] = color565;
+    this->fill_buffer_span_(x, y, step_x, step_y, count, pixel, 2);
+  }
+}
+
+void HOT ST7735::blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors) {
+  if (this->eightbitcolor_) {
+    this->blit_buffer_span_(x, y, step_x, step_y, count, colors, 1,
+                            [](Color color) { return display::ColorUtil::color_to_332(color); });
+  } else {
+    this->blit_buffer_span_(x, y, step_x, step_y, count, colors, 2,
+                            [](Color color) { return display::ColorUtil::color_to_565(color); });
   }
 }
 
@@ -418,15 +467,25 @@ void HOT ST7735::senddata_(const uint8_t *data_bytes, uint8_t num_data_bytes) {
 }
 
 void HOT ST7735::write_display_data_() {
+  display::Rect rects[MAX_FLUSH_RECTS];
+  const size_t count = this->dirty_regions_.take(rects, MAX_FLUSH_RECTS, WINDOW_COST);
+  if (count == 0)
+    return;
+
+  this->enable();
+  for (size_t i = 0; i != count; i++)
+    this->write_display_rect_(rects[i]);
+  this->disable();
+}
+
+void HOT ST7735::write_display_rect_(const display::Rect &rect) {
   uint16_t offsetx = colstart_;
   uint16_t offsety = rowstart_;
 
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
-
-  this->enable();
+  uint16_t x1 = offsetx + rect.x;
+  uint16_t x2 = x1 + rect.w - 1;
+  uint16_t y1 = offsety + rect.y;
+  uint16_t y2 = y1 + rect.h - 1;
 
   // set column(x) address
   this->dc_pin_->digital_write(false);
@@ -445,9 +504,10 @@ void HOT ST7735::write_display_data_() {
   this->write_byte(ST77XX_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const int width = this->get_width_internal();
   if (this->eightbitcolor_) {
-    for (size_t line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (int line = rect.y * width; line < rect.y2() * width; line = line + width) {
+      for (int index = rect.x; index < rect.x2(); ++index) {
         auto color332 = display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                                      display::ColorBitness::COLOR_BITNESS_332, true);
 
@@ -457,10 +517,13 @@ void HOT ST7735::write_display_data_() {
         this->write_byte(color & 0xff);
       }
     }
+  } else if (rect.w == width) {
+    // whole rows are one block in the buffer
+    this->write_array(this->buffer_ + rect.y * width * 2, rect.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
+    for (int y = rect.y; y < rect.y2(); y++)
+      this->write_array(this->buffer_ + (y * width + rect.x) * 2, rect.w * 2);
   }
-  this->disable();
 }
 
 void ST7735::spi_master_write_addr_(uint16_t addr1, uint16_t addr2) {
@@ -44,6 +44,7 @@ class ST7735 : public display::DisplayBuffer,
   void display();
 
   void update() override;
+  void fill(Color color) override;
 
   void set_model(ST7735Model model) { this->model_ = model; }
   float get_setup_priority() const override { return setup_priority::PROCESSOR; }
@@ -62,11 +63,14 @@ class ST7735 : public display::DisplayBuffer,
   void writedata_(uint8_t value);
 
   void write_display_data_();
+  void write_display_rect_(const display::Rect &rect);
 
   void init_reset_();
   void display_init_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) override;
+  void blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors) override;
   void spi_master_write_addr_(uint16_t addr1, uint16_t addr2);
   void spi_master_write_color_(uint16_t color, uint16_t size);
 
@@ -6,6 +6,9 @@ namespace st7789v {
 
 static const char *const TAG = "st7789v";
 static const size_t TEMP_BUFFER_SIZE = 128;
+static const size_t MAX_FLUSH_RECTS = 8;
+// setting the window is 11 bytes plus switching DC in the same transaction, about as long as sending this many pixels
+static const uint32_t WINDOW_COST = 32;
 
 void ST7789V::setup() {
   ESP_LOGCONFIG(TAG, "Setting up SPI ST7789V...");
@@ -149,12 +152,22 @@ void ST7789V::update() {
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  display::Rect rects[MAX_FLUSH_RECTS];
+  const size_t count = this->dirty_regions_.take(rects, MAX_FLUSH_RECTS, WINDOW_COST);
+  if (count == 0)
+    return;
 
   this->enable();
+  for (size_t i = 0; i != count; i++)
+    this->write_display_rect_(rects[i]);
+  this->disable();
+}
+
+void ST7789V::write_display_rect_(const display::Rect &rect) {
+  uint16_t x1 = this->offset_height_ + rect.x;
+  uint16_t x2 = x1 + rect.w - 1;
+  uint16_t y1 = this->offset_width_ + rect.y;
+  uint16_t y2 = y1 + rect.h - 1;
 
   // set column(x) address
   this->dc_pin_->digital_write(false);
@@ -171,11 +184,12 @@ void ST7789V::write_display_data() {
   this->write_byte(ST7789_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const int width = this->get_width_internal();
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (int line = rect.y * width; line < rect.y2() * width; line = line + width) {
+      for (int index = rect.x; index < rect.x2(); ++index) {
         auto color = display::ColorUtil::color_to_565(
             display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
@@ -189,11 +203,13 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (rect.w == width) {
+    // whole rows are one block in the buffer
+    this->write_array(this->buffer_ + rect.y * width * 2, rect.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int y = rect.y; y < rect.y2(); y++)
+      this->write_array(this->buffer_ + (y * width + rect.x) * 2, rect.w * 2);
   }
-
-  this->disable();
 }
 
 void ST7789V::init_reset_() {
@@ -289,6 +305,23 @@ void ST7789V::draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
   this->disable();
 }
 
+void ST7789V::fill(Color color) {
+  if (this->is_clipping()) {
+    Display::fill(color);
+    return;
+  }
+  uint8_t pixel[2];
+  if (this->eightbitcolor_) {
+    pixel[0] = display::ColorUtil::color_to_332(color);
+    this->fill_buffer_(pixel, 1);
+  } else {
+    const uint16_t color565 = display::ColorUtil::color_to_565(color);
+    pixel[0] = color565 >> 8;
+    pixel[1] = color565;
+    this->fill_buffer_(pixel, 2);
+  }
+}
+
 void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
@@ -296,12 +329,41 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
-    this->buffer_[pos++] = (color565 >> 8) & 0xff;
-    this->buffer_[pos] = color565 & 0xff;
+    const uint8_t high = color565 >> 8, low = color565;
+    if (this->buffer_[pos] == high && this->buffer_[pos + 1] == low)
+      return;
+    this->buffer_[pos++] = high;
+    this->buffer_[pos] = low;
+  }
+  this->dirty_regions_.mark(x, y);
+}
+
+void HOT ST7789V::fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) {
+  uint8_t pixel[2];
+  if (this->eightbitcolor_) {
+    pixel[0] = display::ColorUtil::color_to_332(color);
+    this->fill_buffer_span_(x, y, step_x, step_y, count, pixel, 1);
+  } else {
+    const uint16_t color565 = display::ColorUtil::color_to_565(color);
+    pixel[0] = color565 >> 8;
+    pixel[1] = color565;
+    this->fill_buffer_span_(x, y, step_x, step_y, count, pixel, 2);
+  }
+}
+
+void HOT ST7789V::blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors) {
+  if (this->eightbitcolor_) {
+    this->blit_buffer_span_(x, y, step_x, step_y, count, colors, 1,
+                            [](Color color) { return display::ColorUtil::color_to_332(color); });
+  } else {
+    this->blit_buffer_span_(x, y, step_x, step_y, count, colors, 2,
+                            [](Color color) { return display::ColorUtil::color_to_565(color); });
   }
 }
 
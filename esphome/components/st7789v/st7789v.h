@@ -131,7 +131,9 @@ class ST7789V : public display::DisplayBuffer,
   void dump_config() override;
   float get_setup_priority() const override;
   void update() override;
+  void fill(Color color) override;
 
+  /// Send the parts of the buffer that changed since the last call.
   void write_display_data();
 
   display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_COLOR; }
@@ -156,6 +158,7 @@ class ST7789V : public display::DisplayBuffer,
   void write_data_(uint8_t value);
   void write_addr_(uint16_t addr1, uint16_t addr2);
   void write_color_(uint16_t color, uint16_t size);
+  void write_display_rect_(const display::Rect &rect);
 
   int get_height_internal() override { return this->height_; }
   int get_width_internal() override { return this->width_; }
@@ -164,6 +167,8 @@ class ST7789V : public display::DisplayBuffer,
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_span_internal(int x, int y, int step_x, int step_y, int count, Color color) override;
+  void blit_absolute_span_internal(int x, int y, int step_x, int step_y, int count, const Color *colors) override;
 
   const char *model_str_;
 };
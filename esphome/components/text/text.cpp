@@ -18,7 +18,7 @@ void Text::publish_state(const std::string &state) {
   this->state_callback_.call(state);
 }
 
-void Text::add_on_state_callback(std::function<void(std::string)> &&callback) {
+void Text::add_on_state_callback(InlineFunction<void(std::string)> &&callback) {
   this->state_callback_.add(std::move(callback));
 }
 
@@ -118,7 +118,7 @@ class Valve : public EntityBase, public EntityBase_DeviceClass {
   /// Construct a new valve call used to control the valve.
   ValveCall make_call();
 
-  void add_on_state_callback(std::function<void()> &&f);
+  void add_on_state_callback(InlineFunction<void()> &&f);
 
   /** Publish the current state of the valve.
    *
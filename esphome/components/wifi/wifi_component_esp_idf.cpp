@@ -126,7 +126,12 @@ void event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, voi
   // don't block, we may miss events but the core can handle that
   if (xQueueSend(s_event_queue, &to_send, 0L) != pdPASS) {
     delete to_send;  // NOLINT(cppcoreguidelines-owning-memory)
+    return;
   }
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  // Handle the event right away instead of after the loop's sleep
+  App.wake_loop_threadsafe();
+#endif
 }
 
 void WiFiComponent::wifi_pre_setup_() {
@@ -151,6 +156,9 @@ void WiFiComponent::wifi_pre_setup_() {
     ESP_LOGE(TAG, "xQueueCreate failed");
     return;
   }
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  App.enable_loop_wakeup();
+#endif
   err = esp_event_loop_create_default();
   if (err != ERR_OK) {
     ESP_LOGE(TAG, "esp_event_loop_create_default failed: %s", esp_err_to_name(err));
@@ -7,6 +7,10 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include <cerrno>
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
@@ -55,13 +59,17 @@ void Application::setup() {
         this->feed_wdt();
       }
       this->app_state_ = new_app_state;
-      yield();
+      // also refreshes which monitored sockets are readable, otherwise they'd never report ready during setup
+      this->yield_with_select_(0);
     } while (!component->can_proceed());
   }
 
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
   this->calculate_looping_components_();
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  this->setup_wake_loop_();
+#endif
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
@@ -70,7 +78,7 @@ void Application::loop() {
   this->feed_wdt();
   for (Component *component : this->looping_components_) {
     {
-      WarnIfComponentBlockingGuard guard{component};
+      WarnIfComponentBlockingGuard guard{component, ComponentActivity::LOOP};
       component->call();
     }
     new_app_state |= component->get_component_state();
@@ -83,15 +91,18 @@ void Application::loop() {
 
   auto elapsed = now - this->last_loop_;
   if (elapsed >= this->loop_interval_ || HighFrequencyLoopRequester::is_high_frequency()) {
-    yield();
+    this->yield_with_select_(0);
   } else {
     uint32_t delay_time = this->loop_interval_ - elapsed;
     uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
+#ifndef USE_SCHEDULER_TIMING_WHEEL
     // next_schedule is max 0.5*delay_time
     // otherwise interval=0 schedules result in constant looping with almost no sleep
+    // (the timing wheel doesn't count those, so its next_schedule_in() can be used as is)
     next_schedule = std::max(next_schedule, delay_time / 2);
+#endif
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+    this->yield_with_select_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -143,6 +154,112 @@ void Application::run_safe_shutdown_hooks() {
   }
 }
 
+void Application::yield_with_select_(uint32_t delay_ms) {
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  // The wake-up socket only matters while sleeping, without other sockets there's nothing to poll for
+  const size_t polled =
+      this->socket_fds_.size() - (this->wake_socket_.load(std::memory_order_relaxed) != nullptr ? 1 : 0);
+  if (polled != 0 || (delay_ms != 0 && !this->socket_fds_.empty())) {
+    // select() leaves only the ready fds in the set
+    this->read_fds_ = this->base_read_fds_;
+    struct timeval tv;
+    tv.tv_sec = delay_ms / 1000;
+    tv.tv_usec = (delay_ms % 1000) * 1000;
+#ifdef USE_SOCKET_IMPL_LWIP_SOCKETS
+    int ret = lwip_select(this->max_fd_ + 1, &this->read_fds_, nullptr, nullptr, &tv);
+#else
+    int ret = ::select(this->max_fd_ + 1, &this->read_fds_, nullptr, nullptr, &tv);
+#endif
+    if (ret > 0) {
+      this->drain_wake_loop_();
+    } else if (ret < 0 && errno != EINTR) {
+      // Don't let a broken select() starve the sockets, report all of them as ready and just sleep instead
+      this->read_fds_ = this->base_read_fds_;
+      if (delay_ms != 0)
+        delay(delay_ms);
+    }
+    if (delay_ms == 0)
+      yield();
+    return;
+  }
+#endif
+  if (delay_ms == 0) {
+    yield();
+  } else {
+    delay(delay_ms);
+  }
+}
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+bool Application::register_socket_fd(int fd) {
+  if (fd < 0)
+    return false;
+  if (fd >= FD_SETSIZE) {
+    ESP_LOGE(TAG, "Socket fd %d exceeds FD_SETSIZE (%d), it won't wake up the loop", fd, FD_SETSIZE);
+    return false;
+  }
+
+  this->socket_fds_.push_back(fd);
+  FD_SET(fd, &this->base_read_fds_);
+  this->max_fd_ = std::max(this->max_fd_, fd);
+  return true;
+}
+void Application::unregister_socket_fd(int fd) {
+  auto it = std::find(this->socket_fds_.begin(), this->socket_fds_.end(), fd);
+  if (it == this->socket_fds_.end())
+    return;
+
+  *it = this->socket_fds_.back();
+  this->socket_fds_.pop_back();
+  FD_CLR(fd, &this->base_read_fds_);
+  FD_CLR(fd, &this->read_fds_);
+  if (fd == this->max_fd_) {
+    this->max_fd_ = -1;
+    for (int other : this->socket_fds_)
+      this->max_fd_ = std::max(this->max_fd_, other);
+  }
+}
+bool Application::is_socket_ready(int fd) const { return fd >= 0 && fd < FD_SETSIZE && FD_ISSET(fd, &this->read_fds_); }
+void Application::wake_loop_threadsafe() {
+  socket::Socket *sock = this->wake_socket_.load(std::memory_order_acquire);
+  if (sock == nullptr)
+    return;
+  const uint8_t dummy = 0;
+  sock->sendto(&dummy, 1, 0, reinterpret_cast<struct sockaddr *>(&this->wake_addr_), this->wake_addr_len_);
+}
+void Application::setup_wake_loop_() {
+  if (!this->wake_loop_enabled_)
+    return;
+  auto sock = socket::socket(AF_INET, SOCK_DGRAM, 0);
+  if (sock == nullptr) {
+    ESP_LOGW(TAG, "Could not create loop wake-up socket");
+    return;
+  }
+  socklen_t len = socket::set_sockaddr(reinterpret_cast<struct sockaddr *>(&this->wake_addr_),
+                                       sizeof(this->wake_addr_), "127.0.0.1", 0);
+  // Bind to an ephemeral port and look up which one we got, that's where wake-ups are sent to
+  if (len == 0 || sock->bind(reinterpret_cast<struct sockaddr *>(&this->wake_addr_), len) != 0 ||
+      sock->getsockname(reinterpret_cast<struct sockaddr *>(&this->wake_addr_), &len) != 0) {
+    ESP_LOGW(TAG, "Could not bind loop wake-up socket: errno %d", errno);
+    return;
+  }
+  sock->setblocking(false);
+  if (!this->register_socket_fd(sock->get_fd()))
+    return;
+  this->wake_addr_len_ = len;
+  // publishes wake_addr_ along with the socket to the tasks calling wake_loop_threadsafe()
+  this->wake_socket_.store(sock.release(), std::memory_order_release);
+}
+void Application::drain_wake_loop_() {
+  socket::Socket *sock = this->wake_socket_.load(std::memory_order_relaxed);
+  if (sock == nullptr || !this->is_socket_ready(sock->get_fd()))
+    return;
+  uint8_t buf[16];
+  while (sock->read(buf, sizeof(buf)) > 0) {
+  }
+}
+#endif
+
 void Application::calculate_looping_components_() {
   for (auto *obj : this->components_) {
     if (obj->has_overridden_loop())
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
@@ -72,9 +74,50 @@
 #ifdef USE_UPDATE
 #include "esphome/components/update/update_entity.h"
 #endif
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include <atomic>
+#include "esphome/components/socket/socket.h"
+#endif
 
 namespace esphome {
 
+/** Entities of one type sorted by object id hash, so they can be looked up by key with a binary search.
+ *
+ * The hashes are only known once the entities got their names, which is after they're registered, so the index is
+ * (re)built on the first lookup after the set of entities changed.
+ */
+template<typename T> class EntityKeyIndex {
+ public:
+  /// Find the first entity of \p entities (in registration order) with the given key.
+  T *find(const std::vector<T *> &entities, uint32_t key, bool include_internal) {
+    if (this->entries_.size() != entities.size())
+      this->rebuild_(entities);
+
+    auto it = std::lower_bound(this->entries_.begin(), this->entries_.end(), key,
+                               [](const Entry &entry, uint32_t key) { return entry.first < key; });
+    for (; it != this->entries_.end() && it->first == key; ++it) {
+      if (include_internal || !it->second->is_internal())
+        return it->second;
+    }
+    return nullptr;
+  }
+
+ protected:
+  using Entry = std::pair<uint32_t, T *>;
+
+  void rebuild_(const std::vector<T *> &entities) {
+    this->entries_.clear();
+    this->entries_.reserve(entities.size());
+    for (auto *obj : entities)
+      this->entries_.emplace_back(obj->get_object_id_hash(), obj);
+    // stable, so entities sharing a key are still found in registration order
+    std::stable_sort(this->entries_.begin(), this->entries_.end(),
+                     [](const Entry &a, const Entry &b) { return a.first < b.first; });
+  }
+
+  std::vector<Entry> entries_;
+};
+
 class Application {
  public:
   void pre_setup(const std::string &name, const std::string &friendly_name, const std::string &area,
@@ -243,184 +286,146 @@ class Application {
 
   uint32_t get_app_state() const { return this->app_state_; }
 
+  /// All registered components, in setup order once setup() ran.
+  const std::vector<Component *> &get_components() const { return this->components_; }
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  /** Register a socket file descriptor to be watched for incoming data while the loop sleeps.
+   *
+   * Instead of sleeping for the rest of the loop interval, the loop then wakes up as soon as data arrives on any
+   * registered socket. Must only be called from the main loop.
+   *
+   * @return Whether the fd could be registered.
+   */
+  bool register_socket_fd(int fd);
+
+  /// Stop watching a socket file descriptor. Must only be called from the main loop.
+  void unregister_socket_fd(int fd);
+
+  /** Whether the last wait of the loop found data available on this socket.
+   *
+   * Sockets that were registered after that wait (or aren't registered at all) are not reported as ready.
+   */
+  bool is_socket_ready(int fd) const;
+
+  /** Wake up the main loop if it is waiting, e.g. after queueing work from another task.
+   *
+   * Safe to call from any task except the network stack's own, but not from an ISR. Does nothing unless
+   * enable_loop_wakeup() was called during setup.
+   */
+  void wake_loop_threadsafe();
+
+  /// Set up wake_loop_threadsafe() once setup() finished. Called by components that hand work to the loop from other
+  /// tasks, so that devices without any don't pay for the wake-up socket.
+  void enable_loop_wakeup() { this->wake_loop_enabled_ = true; }
+#endif
+
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->binary_sensor_index_.find(this->binary_sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->switch_index_.find(this->switches_, key, include_internal);
   }
 #endif
 #ifdef USE_BUTTON
   const std::vector<button::Button *> &get_buttons() { return this->buttons_; }
   button::Button *get_button_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->buttons_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->button_index_.find(this->buttons_, key, include_internal);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->sensor_index_.find(this->sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->text_sensor_index_.find(this->text_sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::Fan *> &get_fans() { return this->fans_; }
   fan::Fan *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->fan_index_.find(this->fans_, key, include_internal);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->cover_index_.find(this->covers_, key, include_internal);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->light_index_.find(this->lights_, key, include_internal);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->climate_index_.find(this->climates_, key, include_internal);
   }
 #endif
 #ifdef USE_NUMBER
   const std::vector<number::Number *> &get_numbers() { return this->numbers_; }
   number::Number *get_number_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->numbers_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->number_index_.find(this->numbers_, key, include_internal);
   }
 #endif
 #ifdef USE_DATETIME_DATE
   const std::vector<datetime::DateEntity *> &get_dates() { return this->dates_; }
   datetime::DateEntity *get_date_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->dates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->date_index_.find(this->dates_, key, include_internal);
   }
 #endif
 #ifdef USE_DATETIME_TIME
   const std::vector<datetime::TimeEntity *> &get_times() { return this->times_; }
   datetime::TimeEntity *get_time_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->times_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->time_index_.find(this->times_, key, include_internal);
   }
 #endif
 #ifdef USE_DATETIME_DATETIME
   const std::vector<datetime::DateTimeEntity *> &get_datetimes() { return this->datetimes_; }
   datetime::DateTimeEntity *get_datetime_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->datetimes_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->datetime_index_.find(this->datetimes_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT
   const std::vector<text::Text *> &get_texts() { return this->texts_; }
   text::Text *get_text_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->texts_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->text_index_.find(this->texts_, key, include_internal);
   }
 #endif
 #ifdef USE_SELECT
   const std::vector<select::Select *> &get_selects() { return this->selects_; }
   select::Select *get_select_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->selects_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->select_index_.find(this->selects_, key, include_internal);
   }
 #endif
 #ifdef USE_LOCK
   const std::vector<lock::Lock *> &get_locks() { return this->locks_; }
   lock::Lock *get_lock_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->locks_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->lock_index_.find(this->locks_, key, include_internal);
   }
 #endif
 #ifdef USE_VALVE
   const std::vector<valve::Valve *> &get_valves() { return this->valves_; }
   valve::Valve *get_valve_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->valves_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->valve_index_.find(this->valves_, key, include_internal);
   }
 #endif
 #ifdef USE_MEDIA_PLAYER
   const std::vector<media_player::MediaPlayer *> &get_media_players() { return this->media_players_; }
   media_player::MediaPlayer *get_media_player_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->media_players_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->media_player_index_.find(this->media_players_, key, include_internal);
   }
 #endif
 
@@ -429,33 +434,21 @@ class Application {
     return this->alarm_control_panels_;
   }
   alarm_control_panel::AlarmControlPanel *get_alarm_control_panel_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->alarm_control_panels_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->alarm_control_panel_index_.find(this->alarm_control_panels_, key, include_internal);
   }
 #endif
 
 #ifdef USE_EVENT
   const std::vector<event::Event *> &get_events() { return this->events_; }
   event::Event *get_event_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->events_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->event_index_.find(this->events_, key, include_internal);
   }
 #endif
 
 #ifdef USE_UPDATE
   const std::vector<update::UpdateEntity *> &get_updates() { return this->updates_; }
   update::UpdateEntity *get_update_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->updates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->update_index_.find(this->updates_, key, include_internal);
   }
 #endif
 
@@ -470,71 +463,100 @@ class Application {
 
   void feed_wdt_arch_();
 
+  /// Sleep for the given time, waking up early if data arrives on a registered socket.
+  void yield_with_select_(uint32_t delay_ms);
+
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  void setup_wake_loop_();
+  void drain_wake_loop_();
+#endif
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  EntityKeyIndex<binary_sensor::BinarySensor> binary_sensor_index_{};
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  EntityKeyIndex<switch_::Switch> switch_index_{};
 #endif
 #ifdef USE_BUTTON
   std::vector<button::Button *> buttons_{};
+  EntityKeyIndex<button::Button> button_index_{};
 #endif
 #ifdef USE_EVENT
   std::vector<event::Event *> events_{};
+  EntityKeyIndex<event::Event> event_index_{};
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  EntityKeyIndex<sensor::Sensor> sensor_index_{};
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  EntityKeyIndex<text_sensor::TextSensor> text_sensor_index_{};
 #endif
 #ifdef USE_FAN
   std::vector<fan::Fan *> fans_{};
+  EntityKeyIndex<fan::Fan> fan_index_{};
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  EntityKeyIndex<cover::Cover> cover_index_{};
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  EntityKeyIndex<climate::Climate> climate_index_{};
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  EntityKeyIndex<light::LightState> light_index_{};
 #endif
 #ifdef USE_NUMBER
   std::vector<number::Number *> numbers_{};
+  EntityKeyIndex<number::Number> number_index_{};
 #endif
 #ifdef USE_DATETIME_DATE
   std::vector<datetime::DateEntity *> dates_{};
+  EntityKeyIndex<datetime::DateEntity> date_index_{};
 #endif
 #ifdef USE_DATETIME_TIME
   std::vector<datetime::TimeEntity *> times_{};
+  EntityKeyIndex<datetime::TimeEntity> time_index_{};
 #endif
 #ifdef USE_DATETIME_DATETIME
   std::vector<datetime::DateTimeEntity *> datetimes_{};
+  EntityKeyIndex<datetime::DateTimeEntity> datetime_index_{};
 #endif
 #ifdef USE_SELECT
   std::vector<select::Select *> selects_{};
+  EntityKeyIndex<select::Select> select_index_{};
 #endif
 #ifdef USE_TEXT
   std::vector<text::Text *> texts_{};
+  EntityKeyIndex<text::Text> text_index_{};
 #endif
 #ifdef USE_LOCK
   std::vector<lock::Lock *> locks_{};
+  EntityKeyIndex<lock::Lock> lock_index_{};
 #endif
 #ifdef USE_VALVE
   std::vector<valve::Valve *> valves_{};
+  EntityKeyIndex<valve::Valve> valve_index_{};
 #endif
 #ifdef USE_MEDIA_PLAYER
   std::vector<media_player::MediaPlayer *> media_players_{};
+  EntityKeyIndex<media_player::MediaPlayer> media_player_index_{};
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
   std::vector<alarm_control_panel::AlarmControlPanel *> alarm_control_panels_{};
+  EntityKeyIndex<alarm_control_panel::AlarmControlPanel> alarm_control_panel_index_{};
 #endif
 #ifdef USE_UPDATE
   std::vector<update::UpdateEntity *> updates_{};
+  EntityKeyIndex<update::UpdateEntity> update_index_{};
 #endif
 
   std::string name_;
@@ -547,6 +569,20 @@ class Application {
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  std::vector<int> socket_fds_{};
+  /// All registered fds, copied into read_fds_ before every wait.
+  fd_set base_read_fds_{};
+  /// The fds that had data available after the last wait.
+  fd_set read_fds_{};
+  int max_fd_{-1};
+  /// Loopback UDP socket that wake_loop_threadsafe() sends a byte to. Set once by setup_wake_loop_() after
+  /// wake_addr_, other tasks read it with acquire so they see the address too. Never freed.
+  std::atomic<socket::Socket *> wake_socket_{nullptr};
+  struct sockaddr_storage wake_addr_ {};
+  socklen_t wake_addr_len_{0};
+  bool wake_loop_enabled_{false};
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
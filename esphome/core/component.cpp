@@ -1,5 +1,6 @@
 #include "esphome/core/component.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <utility>
 #include "esphome/core/application.h"
@@ -228,16 +229,72 @@ void PollingComponent::stop_poller() {
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
+#ifdef USE_COMPONENT_PROFILING
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
+    : started_us_(micros()), component_(component) {}
+#else
 WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
     : started_(millis()), component_(component) {}
+#endif
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, ComponentActivity activity)
+    : WarnIfComponentBlockingGuard(component) {
+#ifdef USE_COMPONENT_PROFILING
+  this->profile_ = component != nullptr;
+  this->activity_ = activity;
+#endif
+}
 WarnIfComponentBlockingGuard::~WarnIfComponentBlockingGuard() {
-  uint32_t now = millis();
-  if (now - started_ > 50) {
+#ifdef USE_COMPONENT_PROFILING
+  const uint32_t duration_us = micros() - this->started_us_;
+  if (this->profile_)
+    this->component_->record_activity(this->activity_, duration_us);
+  const uint32_t duration = duration_us / 1000;
+#else
+  const uint32_t duration = millis() - this->started_;
+#endif
+  if (duration > 50) {
     const char *src = component_ == nullptr ? "<null>" : component_->get_component_source();
-    ESP_LOGW(TAG, "Component %s took a long time for an operation (%" PRIu32 " ms).", src, (now - started_));
+    ESP_LOGW(TAG, "Component %s took a long time for an operation (%" PRIu32 " ms).", src, duration);
     ESP_LOGW(TAG, "Components should block for at most 30 ms.");
     ;
   }
 }
 
+#ifdef USE_COMPONENT_PROFILING
+void Component::record_activity(ComponentActivity activity, uint32_t duration_us) {
+  if (this->profile_ == nullptr)
+    this->profile_ = make_unique<ComponentProfile>();
+  switch (activity) {
+    case ComponentActivity::LOOP:
+      this->profile_->loop.record(duration_us);
+      break;
+    case ComponentActivity::UPDATE:
+      this->profile_->update.record(duration_us);
+      break;
+    case ComponentActivity::SCHEDULER:
+      this->profile_->scheduler.record(duration_us);
+      break;
+  }
+}
+
+void TimingStats::record(uint32_t duration_us) {
+  this->count++;
+  this->total_us += duration_us;
+  this->max_us = std::max(this->max_us, duration_us);
+  uint8_t bucket = duration_us == 0 ? 0 : 31 - __builtin_clz(duration_us);
+  this->histogram[std::min<uint8_t>(bucket, HISTOGRAM_BUCKETS - 1)]++;
+}
+uint32_t TimingStats::percentile_upper_bound(uint8_t percentile) const {
+  // rank of the requested sample, rounded up
+  uint64_t rank = (uint64_t(this->count) * percentile + 99) / 100;
+  uint64_t seen = 0;
+  for (uint8_t i = 0; i < HISTOGRAM_BUCKETS - 1; i++) {
+    seen += this->histogram[i];
+    if (seen >= rank)
+      return std::min(uint32_t(2) << i, this->max_us);
+  }
+  return this->max_us;
+}
+#endif
+
 }  // namespace esphome
@@ -3,8 +3,10 @@
 #include <cmath>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -65,6 +67,33 @@ extern const uint32_t STATUS_LED_ERROR;
 
 enum class RetryResult { DONE, RETRY };
 
+/// The kinds of work the core runs on behalf of a component, see WarnIfComponentBlockingGuard.
+enum class ComponentActivity : uint8_t { LOOP, UPDATE, SCHEDULER };
+
+#ifdef USE_COMPONENT_PROFILING
+/// Duration statistics of one kind of work, in microseconds.
+struct TimingStats {
+  /// Bucket i counts durations in [2^i, 2^(i+1)) us; the first bucket also counts 0 us, the last everything above.
+  static const uint8_t HISTOGRAM_BUCKETS = 16;
+
+  void record(uint32_t duration_us);
+  /// Upper bound of the histogram bucket containing the given percentile (0-100) of all recorded durations.
+  uint32_t percentile_upper_bound(uint8_t percentile) const;
+
+  uint32_t count{0};
+  uint64_t total_us{0};
+  uint32_t max_us{0};
+  uint32_t histogram[HISTOGRAM_BUCKETS]{};
+};
+
+/// Time spent in a component, recorded when USE_COMPONENT_PROFILING is enabled (`debug: profiling: true`).
+struct ComponentProfile {
+  TimingStats loop;
+  TimingStats update;
+  TimingStats scheduler;
+};
+#endif
+
 class Component {
  public:
   /** Where the component's initialization should happen.
@@ -153,6 +182,15 @@ class Component {
    */
   const char *get_component_source() const;
 
+#ifdef USE_COMPONENT_PROFILING
+  /// Get the timing statistics of this component, nullptr if none of its code has run since the last reset.
+  const ComponentProfile *get_profile() const { return this->profile_.get(); }
+  /// Start a new measurement window for get_profile().
+  void reset_profile() { this->profile_.reset(); }
+  /// Add one run of \p activity that took \p duration_us microseconds to this component's profile.
+  void record_activity(ComponentActivity activity, uint32_t duration_us);
+#endif
+
  protected:
   friend class Application;
 
@@ -272,6 +310,9 @@ class Component {
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+#ifdef USE_COMPONENT_PROFILING
+  std::unique_ptr<ComponentProfile> profile_;
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -322,11 +363,22 @@ class PollingComponent : public Component {
 class WarnIfComponentBlockingGuard {
  public:
   WarnIfComponentBlockingGuard(Component *component);
+  /// Like above, and additionally record the time spent as \p activity in the component's profile.
+  WarnIfComponentBlockingGuard(Component *component, ComponentActivity activity);
   ~WarnIfComponentBlockingGuard();
 
  protected:
+#ifdef USE_COMPONENT_PROFILING
+  /// The profile needs microseconds, the blocking check uses the same reading.
+  uint32_t started_us_;
+#else
   uint32_t started_;
+#endif
   Component *component_;
+#ifdef USE_COMPONENT_PROFILING
+  bool profile_{false};
+  ComponentActivity activity_;
+#endif
 };
 
 }  // namespace esphome
@@ -60,6 +60,10 @@ ProjectUpdateTrigger = cg.esphome_ns.class_(
 VERSION_REGEX = re.compile(r"^[0-9]+\.[0-9]+\.[0-9]+(?:[ab]\d+)?$")
 
 CONF_NAME_ADD_MAC_SUFFIX = "name_add_mac_suffix"
+CONF_SCHEDULER = "scheduler"
+
+SCHEDULER_HEAP = "heap"
+SCHEDULER_TIMING_WHEEL = "timing_wheel"
 
 
 VALID_INCLUDE_EXTS = {".h", ".hpp", ".tcc", ".ino", ".cpp", ".c"}
@@ -146,6 +150,10 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
+            # The timing wheel is only faster with about a hundred or more timers, see scheduler.h
+            cv.Optional(CONF_SCHEDULER, default=SCHEDULER_HEAP): cv.one_of(
+                SCHEDULER_HEAP, SCHEDULER_TIMING_WHEEL, lower=True
+            ),
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -364,6 +372,9 @@ async def to_code(config):
 
     cg.add_build_flag("-fno-exceptions")
 
+    if config[CONF_SCHEDULER] == SCHEDULER_TIMING_WHEEL:
+        cg.add_define("USE_SCHEDULER_TIMING_WHEEL")
+
     # Libraries
     for lib in config[CONF_LIBRARIES]:
         if "@" in lib:
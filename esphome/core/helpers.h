@@ -1,9 +1,11 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -64,10 +66,12 @@ std::string to_string(long double value);
 #if _GLIBCXX_RELEASE >= 6
 using std::is_trivially_copyable;
 #else
-// Implementing this is impossible without compiler intrinsics, so don't bother. Invalid usage will be detected on
-// other variants that use a newer compiler anyway.
+// Approximated with the type trait intrinsics that g++ has had since 4.3.
 // NOLINTNEXTLINE(readability-identifier-naming)
-template<typename T> struct is_trivially_copyable : public std::integral_constant<bool, true> {};
+template<typename T>
+struct is_trivially_copyable
+    : public std::integral_constant<bool,
+                                    __has_trivial_copy(T) && __has_trivial_assign(T) && __has_trivial_destructor(T)> {};
 #endif
 
 // std::make_unique() from C++14
@@ -472,16 +476,111 @@ constexpr float fahrenheit_to_celsius(float value) { return (value - 32.0f) / 1.
 /// @name Utilities
 /// @{
 
+template<typename Signature, size_t Size = sizeof(std::function<void()>)> class InlineFunction;
+
+/** Callable wrapper like std::function, but the callable is always stored inside the object and never on the heap.
+ *
+ * Callables larger than \p Size bytes don't compile. The default size fits lambdas capturing a few pointers, and also
+ * a std::function, so one can still be passed where an InlineFunction is expected.
+ *
+ * @tparam Signature The signature of the callable, like void(float).
+ * @tparam Size The space for the callable in bytes.
+ */
+template<typename R, typename... Args, size_t Size> class InlineFunction<R(Args...), Size> {
+ public:
+  InlineFunction() = default;
+  InlineFunction(std::nullptr_t) {}  // NOLINT(google-explicit-constructor)
+
+  template<typename F, typename D = typename std::decay<F>::type,
+           enable_if_t<!std::is_same<D, InlineFunction>::value && is_invocable<D &, Args...>::value, int> = 0>
+  InlineFunction(F &&f) {  // NOLINT(google-explicit-constructor)
+    static_assert(sizeof(D) <= Size, "Callable doesn't fit into InlineFunction, capture less or capture a pointer");
+    static_assert(alignof(D) <= alignof(Storage), "Callable is aligned more strictly than InlineFunction supports");
+    new (&this->storage_) D(std::forward<F>(f));
+    this->invoke_ = &InlineFunction::invoke_callable_<D>;
+    // Trivial callables (like lambdas that only capture pointers) are copied bytewise and need no manager
+    if (!(is_trivially_copyable<D>::value && std::is_trivially_destructible<D>::value))
+      this->manage_ = &InlineFunction::manage_callable_<D>;
+  }
+
+  InlineFunction(const InlineFunction &other) { this->assign_(other, COPY); }
+  InlineFunction(InlineFunction &&other) noexcept { this->assign_(other, MOVE); }
+  InlineFunction &operator=(const InlineFunction &other) {
+    if (this != &other) {
+      this->reset_();
+      this->assign_(other, COPY);
+    }
+    return *this;
+  }
+  InlineFunction &operator=(InlineFunction &&other) noexcept {
+    if (this != &other) {
+      this->reset_();
+      this->assign_(other, MOVE);
+    }
+    return *this;
+  }
+  ~InlineFunction() { this->reset_(); }
+
+  explicit operator bool() const { return this->invoke_ != nullptr; }
+
+  R operator()(Args... args) const { return this->invoke_(&this->storage_, std::forward<Args>(args)...); }
+
+ protected:
+  enum Operation { COPY, MOVE, DESTROY };
+  using Storage = typename std::aligned_storage<Size, alignof(std::max_align_t)>::type;
+
+  template<typename D> static R invoke_callable_(const Storage *storage, Args... args) {
+    return (*reinterpret_cast<D *>(const_cast<Storage *>(storage)))(std::forward<Args>(args)...);
+  }
+  template<typename D> static void manage_callable_(Operation operation, Storage *dest, Storage *src) {
+    switch (operation) {
+      case COPY:
+        new (dest) D(*reinterpret_cast<const D *>(src));
+        break;
+      case MOVE:
+        new (dest) D(std::move(*reinterpret_cast<D *>(src)));
+        break;
+      case DESTROY:
+        reinterpret_cast<D *>(dest)->~D();
+        break;
+    }
+  }
+
+  void assign_(const InlineFunction &other, Operation operation) {
+    this->invoke_ = other.invoke_;
+    this->manage_ = other.manage_;
+    if (this->manage_ == nullptr) {
+      this->storage_ = other.storage_;
+    } else {
+      this->manage_(operation, &this->storage_, const_cast<Storage *>(&other.storage_));
+    }
+  }
+  void reset_() {
+    if (this->manage_ != nullptr)
+      this->manage_(DESTROY, &this->storage_, nullptr);
+    this->invoke_ = nullptr;
+    this->manage_ = nullptr;
+  }
+
+  Storage storage_;
+  R (*invoke_)(const Storage *, Args...){nullptr};
+  void (*manage_)(Operation, Storage *, Storage *){nullptr};
+};
+
 template<typename... X> class CallbackManager;
 
 /** Helper class to allow having multiple subscribers to a callback.
+ *
+ * The callbacks are stored in InlineFunction, so adding one never allocates anything but room in the list.
  *
  * @tparam Ts The arguments for the callbacks, wrapped in void().
  */
 template<typename... Ts> class CallbackManager<void(Ts...)> {
  public:
+  using Callback = InlineFunction<void(Ts...)>;
+
   /// Add a callback to the list.
-  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  void add(Callback &&callback) { this->callbacks_.push_back(std::move(callback)); }
 
   /// Call all callbacks in this manager.
   void call(Ts... args) {
@@ -494,7 +593,7 @@ template<typename... Ts> class CallbackManager<void(Ts...)> {
   void operator()(Ts... args) { call(args...); }
 
  protected:
-  std::vector<std::function<void(Ts...)>> callbacks_;
+  std::vector<Callback> callbacks_;
 };
 
 /// Helper class to deduplicate items in a series of values.
@@ -10,6 +10,8 @@ namespace esphome {
 static const char *const TAG = "scheduler";
 
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+static const uint32_t MAX_POOLED_ITEMS = 16;
+static const uint32_t MIN_INDEX_BUCKETS = 16;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
@@ -17,7 +19,18 @@ static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
 // A note on locking: the `lock_` lock protects the `items_` and `to_add_` containers. It must be taken when writing to
 // them (i.e. when adding/removing items, but not when changing items). As items are only deleted from the loop task,
 // iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
-// avoid the main thread modifying the list while it is being accessed.
+// avoid the main thread modifying the list while it is being accessed. The same applies to the item pool and the
+// cancel index.
+//
+// Named items are additionally kept in a small intrusive hash index keyed on (component, name, type), so that
+// cancelling (and therefore re-setting) a named timeout or interval doesn't require a scan over all items. An item is
+// in the index from the moment it's pushed until it's cancelled or its timeout has run.
+
+static uint32_t item_key_hash(Component *component, const std::string &name, uint8_t type) {
+  uint32_t hash = fnv1_hash(name);
+  hash ^= static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component)) * 2654435761UL;
+  return hash ^ type;
+}
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> func) {
@@ -31,10 +44,15 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
 
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  std::unique_ptr<SchedulerItem> item;
+  {
+    LockGuard guard{this->lock_};
+    item = this->new_item_();
+  }
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::TIMEOUT;
+  item->key_hash = item_key_hash(component, name, SchedulerItem::TIMEOUT);
   item->timeout = timeout;
   item->last_execution = now;
   item->last_execution_major = this->millis_major_;
@@ -62,10 +80,15 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
 
   ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  std::unique_ptr<SchedulerItem> item;
+  {
+    LockGuard guard{this->lock_};
+    item = this->new_item_();
+  }
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::INTERVAL;
+  item->key_hash = item_key_hash(component, name, SchedulerItem::INTERVAL);
   item->interval = interval;
   item->last_execution = now - offset - interval;
   item->last_execution_major = this->millis_major_;
@@ -134,6 +157,432 @@ bool HOT Scheduler::cancel_retry(Component *component, const std::string &name)
   return this->cancel_timeout(component, "retry$" + name);
 }
 
+void HOT Scheduler::retire_item_(std::unique_ptr<SchedulerItem> item, uint32_t now) {
+  if (item->remove) {
+    // We were removed/cancelled in the function call, stop
+    this->to_remove_--;
+    this->recycle_item_(std::move(item));
+    return;
+  }
+
+  if (item->type == SchedulerItem::INTERVAL) {
+    if (item->interval != 0) {
+      const uint32_t before = item->last_execution;
+      const uint32_t amount = (now - item->last_execution) / item->interval;
+      item->last_execution += amount * item->interval;
+      if (item->last_execution < before)
+        item->last_execution_major++;
+    }
+    // Still in the cancel index, so add it back directly instead of going through push_()
+    this->to_add_.push_back(std::move(item));
+  } else {
+    this->index_remove_(item.get());
+    this->recycle_item_(std::move(item));
+  }
+}
+void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
+  LockGuard guard{this->lock_};
+  this->index_insert_(item.get());
+  this->to_add_.push_back(std::move(item));
+}
+bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
+  // obtain lock because this function iterates and can be called from non-loop task context
+  LockGuard guard{this->lock_};
+  bool ret = false;
+
+  if (!name.empty()) {
+    const uint32_t hash = item_key_hash(component, name, type);
+    SchedulerItem *item;
+    while ((item = this->index_find_(component, name, type, hash)) != nullptr) {
+      this->index_remove_(item);
+      ret = true;
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+      if (item->wheel_pprev != nullptr) {
+        // Neither running nor about to run, so it can go right away
+        this->recycle_item_(this->wheel_unlink_(item));
+        continue;
+      }
+#endif
+      item->remove = true;
+      this->to_remove_++;
+    }
+    return ret;
+  }
+
+  // Unnamed items aren't indexed, fall back to scanning
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  for (auto &level : this->wheel_) {
+    for (auto *head : level) {
+      while (head != nullptr) {
+        auto *it = head;
+        head = head->wheel_next;
+        if (it->component == component && it->name.empty() && it->type == type) {
+          this->recycle_item_(this->wheel_unlink_(it));
+          ret = true;
+        }
+      }
+    }
+  }
+  for (auto &it : this->ready_) {
+    // Entries are moved out one by one while call() runs them
+    if (it != nullptr && it->component == component && it->name.empty() && it->type == type && !it->remove) {
+      to_remove_++;
+      it->remove = true;
+      ret = true;
+    }
+  }
+#else
+  for (auto &it : this->items_) {
+    if (it->component == component && it->name.empty() && it->type == type && !it->remove) {
+      to_remove_++;
+      it->remove = true;
+      ret = true;
+    }
+  }
+#endif
+  for (auto &it : this->to_add_) {
+    if (it->component == component && it->name.empty() && it->type == type && !it->remove) {
+      to_remove_++;
+      it->remove = true;
+      ret = true;
+    }
+  }
+
+  return ret;
+}
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::new_item_() {
+  if (this->pool_.empty())
+    return make_unique<SchedulerItem>();
+  auto item = std::move(this->pool_.back());
+  this->pool_.pop_back();
+  return item;
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  if (this->pool_.size() >= MAX_POOLED_ITEMS)
+    return;
+  // Release the callback's captures now, but keep the name's buffer around for the next user.
+  item->callback = nullptr;
+  item->name.clear();
+  this->pool_.push_back(std::move(item));
+}
+void HOT Scheduler::index_insert_(SchedulerItem *item) {
+  if (item->name.empty())
+    return;
+
+  if (this->index_count_ >= this->index_.size()) {
+    // Grow (or create) the bucket array, keeping the load factor at or below one
+    std::vector<SchedulerItem *> buckets(std::max<size_t>(this->index_.size() * 2, MIN_INDEX_BUCKETS), nullptr);
+    for (auto *head : this->index_) {
+      while (head != nullptr) {
+        auto *next = head->index_next;
+        auto &bucket = buckets[head->key_hash & (buckets.size() - 1)];
+        head->index_next = bucket;
+        bucket = head;
+        head = next;
+      }
+    }
+    this->index_ = std::move(buckets);
+  }
+
+  auto &bucket = this->index_[item->key_hash & (this->index_.size() - 1)];
+  item->index_next = bucket;
+  bucket = item;
+  this->index_count_++;
+}
+void HOT Scheduler::index_remove_(SchedulerItem *item) {
+  if (item->name.empty() || this->index_.empty())
+    return;
+
+  SchedulerItem **link = &this->index_[item->key_hash & (this->index_.size() - 1)];
+  while (*link != nullptr) {
+    if (*link == item) {
+      *link = item->index_next;
+      item->index_next = nullptr;
+      this->index_count_--;
+      return;
+    }
+    link = &(*link)->index_next;
+  }
+}
+Scheduler::SchedulerItem *HOT Scheduler::index_find_(Component *component, const std::string &name,
+                                                     SchedulerItem::Type type, uint32_t hash) {
+  if (this->index_.empty())
+    return nullptr;
+
+  for (auto *item = this->index_[hash & (this->index_.size() - 1)]; item != nullptr; item = item->index_next) {
+    if (item->key_hash == hash && item->component == component && item->type == type && item->name == name)
+      return item;
+  }
+  return nullptr;
+}
+uint32_t Scheduler::millis_() {
+  const uint32_t now = millis();
+  if (now < this->last_millis_) {
+    ESP_LOGD(TAG, "Incrementing scheduler major");
+    this->millis_major_++;
+  }
+  this->last_millis_ = now;
+  return now;
+}
+
+#ifdef USE_COMPONENT_PROFILING
+void Scheduler::record_lateness_(SchedulerItem *item, uint32_t now) {
+  // Intervals of 0 ms just run on every loop, they aren't due at any particular time
+  if (item->type == SchedulerItem::INTERVAL && item->interval == 0)
+    return;
+  // Compare as signed value, so the wrap-around of millis() doesn't matter
+  const int32_t late_ms = std::max<int32_t>(static_cast<int32_t>(now - item->next_execution()), 0);
+  this->lateness_.record(std::min<uint32_t>(late_ms, UINT32_MAX / 1000) * 1000);
+}
+#endif
+
+bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
+                                       const std::unique_ptr<SchedulerItem> &b) {
+  // min-heap
+  // return true if *a* will happen after *b*
+  uint32_t a_next_exec = a->next_execution();
+  uint8_t a_next_exec_major = a->next_execution_major();
+  uint32_t b_next_exec = b->next_execution();
+  uint8_t b_next_exec_major = b->next_execution_major();
+
+  if (a_next_exec_major != b_next_exec_major) {
+    // The "major" calculation is quite complicated.
+    // Basically, we need to check if the major value lies in the future or
+    //
+
+    // Here are some cases to think about:
+    // Format: a_major,b_major -> expected result (a-b, b-a)
+    // a=255,b=0 -> false (255, 1)
+    // a=0,b=1 -> false   (255, 1)
+    // a=1,b=0 -> true    (1, 255)
+    // a=0,b=255 -> true  (1, 255)
+
+    uint8_t diff1 = a_next_exec_major - b_next_exec_major;
+    uint8_t diff2 = b_next_exec_major - a_next_exec_major;
+    return diff1 < diff2;
+  }
+
+  return a_next_exec > b_next_exec;
+}
+
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+// The timing wheel files each item under the slot of its deadline on the lowest level whose range still covers it
+// (level N covers 2^((N + 1) * WHEEL_SLOT_BITS) ms ahead, with slots of 2^(N * WHEEL_SLOT_BITS) ms). When the wheel
+// time enters a slot of a higher level, its items are cascaded down; items in a level 0 slot are due when it's entered.
+// Items further away than the top level's range are filed at its end, and re-filed when they get there.
+
+Scheduler::~Scheduler() {
+  for (auto &level : this->wheel_) {
+    for (auto *&head : level) {
+      while (head != nullptr)
+        this->wheel_unlink_(head);
+    }
+  }
+}
+optional<uint32_t> HOT Scheduler::next_schedule_in() {
+  // Pick up items added since the last call(), e.g. by deferring from a loop()
+  this->process_to_add();
+  const uint64_t now = this->millis_full_(this->millis_());
+
+  LockGuard guard{this->lock_};
+  for (auto &item : this->ready_) {
+    // Intervals of 0 ms run on every loop, they don't need the loop to wake up early
+    if (!item->remove && (item->type != SchedulerItem::INTERVAL || item->interval != 0))
+      return 0;
+  }
+  const uint64_t next = this->wheel_next_deadline_();
+  if (next == UINT64_MAX)
+    return {};
+  if (next <= now)
+    return 0;
+  return std::min<uint64_t>(next - now, UINT32_MAX);
+}
+void HOT Scheduler::call() {
+  const uint32_t now = this->millis_();
+  {
+    LockGuard guard{this->lock_};
+    this->wheel_advance_(this->millis_full_(now));
+  }
+  this->process_to_add();
+
+  // `ready_` is only appended to from the loop task, so it doesn't change while callbacks run
+  for (size_t i = 0; i < this->ready_.size(); i++) {
+    auto &item = this->ready_[i];
+    const bool failed = item->component != nullptr && item->component->is_failed();
+    if (!item->remove && !failed) {
+#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+      ESP_LOGVV(TAG, "Running %s '%s' with interval=%" PRIu32 " last_execution=%" PRIu32 " (now=%" PRIu32 ")",
+                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution, now);
+#endif
+
+#ifdef USE_COMPONENT_PROFILING
+      this->record_lateness_(item.get(), now);
+#endif
+      WarnIfComponentBlockingGuard guard{item->component, item->get_activity()};
+      item->callback();
+    }
+
+    LockGuard guard{this->lock_};
+    auto done = std::move(this->ready_[i]);
+    if (failed && !done->remove) {
+      // Don't run on failed components
+      this->index_remove_(done.get());
+      this->recycle_item_(std::move(done));
+    } else {
+      this->retire_item_(std::move(done), now);
+    }
+  }
+
+  {
+    LockGuard guard{this->lock_};
+    this->ready_.clear();
+  }
+  this->process_to_add();
+}
+void HOT Scheduler::process_to_add() {
+  LockGuard guard{this->lock_};
+  for (auto &it : this->to_add_) {
+    if (it->remove) {
+      this->to_remove_--;
+      this->recycle_item_(std::move(it));
+      continue;
+    }
+
+    this->wheel_insert_(std::move(it));
+  }
+  this->to_add_.clear();
+}
+uint64_t HOT Scheduler::wheel_deadline_(SchedulerItem *item) const {
+  // Derive the full time of the last execution from how long ago it was instead of using last_execution_major,
+  // which wraps around to 255 for intervals that are registered right after boot (they start in the past).
+  const int64_t now = this->millis_full_(this->last_millis_);
+  const int64_t last = now - static_cast<uint32_t>(this->last_millis_ - item->last_execution);
+  return std::max<int64_t>(last + item->timeout, 0);
+}
+void HOT Scheduler::wheel_insert_(std::unique_ptr<SchedulerItem> item) {
+  const uint64_t deadline = this->wheel_deadline_(item.get());
+  item->wheel_deadline = deadline;
+  if ((item->type == SchedulerItem::INTERVAL && item->interval == 0) || deadline < this->wheel_time_) {
+    item->wheel_pprev = nullptr;
+    this->ready_.push_back(std::move(item));
+    return;
+  }
+
+  const uint64_t delta = deadline - this->wheel_time_;
+  uint8_t level = 0;
+  while (level < WHEEL_LEVELS - 1 && delta >= (uint64_t(1) << ((level + 1) * WHEEL_SLOT_BITS)))
+    level++;
+  uint64_t filed_at = deadline;
+  const uint64_t range = uint64_t(1) << (WHEEL_LEVELS * WHEEL_SLOT_BITS);
+  if (delta >= range)
+    filed_at = this->wheel_time_ + range - 1;
+  const uint8_t slot = (filed_at >> (level * WHEEL_SLOT_BITS)) & (WHEEL_SLOTS - 1);
+
+  auto *raw = item.release();
+  auto &head = this->wheel_[level][slot];
+  raw->wheel_next = head;
+  if (head != nullptr)
+    head->wheel_pprev = &raw->wheel_next;
+  raw->wheel_pprev = &head;
+  raw->wheel_level = level;
+  raw->wheel_slot = slot;
+  head = raw;
+  this->wheel_occupied_[level] |= 1UL << slot;
+  this->wheel_count_++;
+}
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::wheel_unlink_(SchedulerItem *item) {
+  *item->wheel_pprev = item->wheel_next;
+  if (item->wheel_next != nullptr)
+    item->wheel_next->wheel_pprev = item->wheel_pprev;
+  if (this->wheel_[item->wheel_level][item->wheel_slot] == nullptr)
+    this->wheel_occupied_[item->wheel_level] &= ~(1UL << item->wheel_slot);
+  item->wheel_next = nullptr;
+  item->wheel_pprev = nullptr;
+  this->wheel_count_--;
+  return std::unique_ptr<SchedulerItem>(item);
+}
+Scheduler::SchedulerItem *HOT Scheduler::wheel_next_slot_(uint8_t level, uint64_t *start) const {
+  const uint32_t occupied = this->wheel_occupied_[level];
+  if (occupied == 0)
+    return nullptr;
+
+  const uint8_t shift = level * WHEEL_SLOT_BITS;
+  const uint64_t block = this->wheel_time_ >> shift;
+  const uint8_t current = block & (WHEEL_SLOTS - 1);
+  // Rotate the mask so bit N stands for the slot N blocks ahead
+  uint32_t ahead = occupied >> current;
+  if (current != 0)
+    ahead |= occupied << (WHEEL_SLOTS - current);
+  // Unless the wheel is right at the start of the current block (which then still has to be entered), items on this
+  // level are filed at least one block ahead, so the current slot is a full turn away.
+  if ((this->wheel_time_ & ((uint64_t(1) << shift) - 1)) != 0)
+    ahead &= ~1UL;
+  const uint32_t offset = ahead == 0 ? WHEEL_SLOTS : __builtin_ctz(ahead);
+
+  *start = (block + offset) << shift;
+  return this->wheel_[level][(current + offset) & (WHEEL_SLOTS - 1)];
+}
+uint64_t HOT Scheduler::wheel_next_event_() const {
+  uint64_t next = UINT64_MAX;
+  for (uint8_t level = 0; level < WHEEL_LEVELS; level++) {
+    uint64_t start;
+    if (this->wheel_next_slot_(level, &start) != nullptr)
+      next = std::min(next, start);
+  }
+  return next;
+}
+uint64_t HOT Scheduler::wheel_next_deadline_() const {
+  uint64_t next = UINT64_MAX;
+  for (uint8_t level = 0; level < WHEEL_LEVELS; level++) {
+    uint64_t start;
+    SchedulerItem *it = this->wheel_next_slot_(level, &start);
+    // Slots are in deadline order per level, so the earliest deadline of each level is in its next slot. Nothing in
+    // it is due before the slot starts, so slots of higher levels (which can hold many items) are only scanned when
+    // they start before everything found so far.
+    if (it == nullptr || start >= next)
+      continue;
+    if (level == 0) {
+      // Level 0 slots are one ms wide
+      next = start;
+      continue;
+    }
+    for (; it != nullptr; it = it->wheel_next)
+      next = std::min(next, it->wheel_deadline);
+  }
+  return next;
+}
+void HOT Scheduler::wheel_advance_(uint64_t now) {
+  while (this->wheel_count_ != 0) {
+    const uint64_t next = this->wheel_next_event_();
+    if (next > now)
+      break;
+    this->wheel_time_ = next;
+
+    // Cascade the slots of higher levels entered at this time, top down
+    for (uint8_t level = WHEEL_LEVELS - 1; level > 0; level--) {
+      const uint8_t shift = level * WHEEL_SLOT_BITS;
+      if ((next & ((uint64_t(1) << shift) - 1)) != 0)
+        continue;
+      SchedulerItem *it = this->wheel_[level][(next >> shift) & (WHEEL_SLOTS - 1)];
+      while (it != nullptr) {
+        SchedulerItem *following = it->wheel_next;
+        this->wheel_insert_(this->wheel_unlink_(it));
+        it = following;
+      }
+    }
+
+    SchedulerItem *it = this->wheel_[0][next & (WHEEL_SLOTS - 1)];
+    while (it != nullptr) {
+      SchedulerItem *following = it->wheel_next;
+      this->ready_.push_back(this->wheel_unlink_(it));
+      it = following;
+    }
+    this->wheel_time_ = next + 1;
+  }
+  this->wheel_time_ = std::max(this->wheel_time_, now + 1);
+}
+#else  // USE_SCHEDULER_TIMING_WHEEL
+
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
   if (this->empty_())
     return {};
@@ -176,29 +625,17 @@ void HOT Scheduler::call() {
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
-  auto to_remove_was = to_remove_;
-  auto items_was = this->items_.size();
   // If we have too many items to remove
-  if (to_remove_ > MAX_LOGICALLY_DELETED_ITEMS) {
-    std::vector<std::unique_ptr<SchedulerItem>> valid_items;
-    while (!this->empty_()) {
-      LockGuard guard{this->lock_};
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
-    }
-
-    {
-      LockGuard guard{this->lock_};
-      this->items_ = std::move(valid_items);
-    }
-
-    // The following should not happen unless I'm missing something
-    if (to_remove_ != 0) {
-      ESP_LOGW(TAG, "to_remove_ was %" PRIu32 " now: %" PRIu32 " items where %zu now %zu. Please report this",
-               to_remove_was, to_remove_, items_was, items_.size());
-      to_remove_ = 0;
+  if (this->to_remove_ > MAX_LOGICALLY_DELETED_ITEMS) {
+    LockGuard guard{this->lock_};
+    auto removed = std::partition(this->items_.begin(), this->items_.end(),
+                                  [](const std::unique_ptr<SchedulerItem> &item) { return !item->remove; });
+    for (auto it = removed; it != this->items_.end(); ++it) {
+      this->to_remove_--;
+      this->recycle_item_(std::move(*it));
     }
+    this->items_.erase(removed, this->items_.end());
+    std::make_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
   }
 
   while (!this->empty_()) {
@@ -217,7 +654,10 @@ void HOT Scheduler::call() {
       // Don't run on failed components
       if (item->component != nullptr && item->component->is_failed()) {
         LockGuard guard{this->lock_};
+        auto failed = std::move(this->items_[0]);
         this->pop_raw_();
+        this->index_remove_(failed.get());
+        this->recycle_item_(std::move(failed));
         continue;
       }
 
@@ -229,14 +669,17 @@ void HOT Scheduler::call() {
       // Warning: During callback(), a lot of stuff can happen, including:
       //  - timeouts/intervals get added, potentially invalidating vector pointers
       //  - timeouts/intervals get cancelled
+#ifdef USE_COMPONENT_PROFILING
+      this->record_lateness_(item.get(), now);
+#endif
       {
-        WarnIfComponentBlockingGuard guard{item->component};
+        WarnIfComponentBlockingGuard guard{item->component, item->get_activity()};
         item->callback();
       }
     }
 
     {
-      this->lock_.lock();
+      LockGuard guard{this->lock_};
 
       // new scope, item from before might have been moved in the vector
       auto item = std::move(this->items_[0]);
@@ -244,25 +687,7 @@ void HOT Scheduler::call() {
       // Only pop after function call, this ensures we were reachable
       // during the function call and know if we were cancelled.
       this->pop_raw_();
-
-      this->lock_.unlock();
-
-      if (item->remove) {
-        // We were removed/cancelled in the function call, stop
-        to_remove_--;
-        continue;
-      }
-
-      if (item->type == SchedulerItem::INTERVAL) {
-        if (item->interval != 0) {
-          const uint32_t before = item->last_execution;
-          const uint32_t amount = (now - item->last_execution) / item->interval;
-          item->last_execution += amount * item->interval;
-          if (item->last_execution < before)
-            item->last_execution_major++;
-        }
-        this->push_(std::move(item));
-      }
+      this->retire_item_(std::move(item), now);
     }
   }
 
@@ -272,6 +697,8 @@ void HOT Scheduler::process_to_add() {
   LockGuard guard{this->lock_};
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      this->to_remove_--;
+      this->recycle_item_(std::move(it));
       continue;
     }
 
@@ -290,7 +717,9 @@ void HOT Scheduler::cleanup_() {
 
     {
       LockGuard guard{this->lock_};
+      auto removed = std::move(this->items_[0]);
       this->pop_raw_();
+      this->recycle_item_(std::move(removed));
     }
   }
 }
@@ -298,67 +727,7 @@ void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
   this->items_.pop_back();
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
-  LockGuard guard{this->lock_};
-  this->to_add_.push_back(std::move(item));
-}
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
-  // obtain lock because this function iterates and can be called from non-loop task context
-  LockGuard guard{this->lock_};
-  bool ret = false;
-  for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
-      to_remove_++;
-      it->remove = true;
-      ret = true;
-    }
-  }
-  for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
-      ret = true;
-    }
-  }
 
-  return ret;
-}
-uint32_t Scheduler::millis_() {
-  const uint32_t now = millis();
-  if (now < this->last_millis_) {
-    ESP_LOGD(TAG, "Incrementing scheduler major");
-    this->millis_major_++;
-  }
-  this->last_millis_ = now;
-  return now;
-}
-
-bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
-                                       const std::unique_ptr<SchedulerItem> &b) {
-  // min-heap
-  // return true if *a* will happen after *b*
-  uint32_t a_next_exec = a->next_execution();
-  uint8_t a_next_exec_major = a->next_execution_major();
-  uint32_t b_next_exec = b->next_execution();
-  uint8_t b_next_exec_major = b->next_execution_major();
-
-  if (a_next_exec_major != b_next_exec_major) {
-    // The "major" calculation is quite complicated.
-    // Basically, we need to check if the major value lies in the future or
-    //
-
-    // Here are some cases to think about:
-    // Format: a_major,b_major -> expected result (a-b, b-a)
-    // a=255,b=0 -> false (255, 1)
-    // a=0,b=1 -> false   (255, 1)
-    // a=1,b=0 -> true    (1, 255)
-    // a=0,b=255 -> true  (1, 255)
-
-    uint8_t diff1 = a_next_exec_major - b_next_exec_major;
-    uint8_t diff2 = b_next_exec_major - a_next_exec_major;
-    return diff1 < diff2;
-  }
-
-  return a_next_exec > b_next_exec;
-}
+#endif  // USE_SCHEDULER_TIMING_WHEEL
 
 }  // namespace esphome
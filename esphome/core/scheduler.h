@@ -10,8 +10,23 @@ namespace esphome {
 
 class Component;
 
+/** Runs the timeouts, intervals and retries registered by components.
+ *
+ * By default pending items are kept in a binary min-heap ordered by their next execution time. With
+ * USE_SCHEDULER_TIMING_WHEEL (`esphome: scheduler: timing_wheel`) a hierarchical timing wheel is used instead,
+ * which has O(1) insertion, cancellation and expiry and can report the exact time until the next item is due.
+ *
+ * The heap stays the default: with the few dozen items of a typical configuration it is as fast or faster, and it
+ * needs no wheel slots. The wheel pays off from about a hundred pending items, or with many timeouts that are set
+ * and cancelled again before they're due (debouncing, retries), which the heap keeps until they reach the top or
+ * a cleanup pass runs.
+ */
 class Scheduler {
  public:
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  ~Scheduler();
+#endif
+
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
   bool cancel_timeout(Component *component, const std::string &name);
   void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func);
@@ -21,12 +36,23 @@ class Scheduler {
                  std::function<RetryResult(uint8_t)> func, float backoff_increase_factor = 1.0f);
   bool cancel_retry(Component *component, const std::string &name);
 
+  /** Time in ms until the next item is due, or empty if nothing is scheduled.
+   *
+   * With the timing wheel backend, intervals with an interval of 0 (which run on every loop anyway) are not taken
+   * into account, so the result can be used to sleep until the next item is due.
+   */
   optional<uint32_t> next_schedule_in();
 
   void call();
 
   void process_to_add();
 
+#ifdef USE_COMPONENT_PROFILING
+  /// How late items ran compared to when they were due, in microseconds (with millisecond resolution).
+  const TimingStats &get_lateness() const { return this->lateness_; }
+  void reset_lateness() { this->lateness_ = TimingStats{}; }
+#endif
+
  protected:
   struct SchedulerItem {
     Component *component;
@@ -40,6 +66,20 @@ class Scheduler {
     std::function<void()> callback;
     bool remove;
     uint8_t last_execution_major;
+    /// Hash of (component, name, type), used to place named items in the cancel index.
+    uint32_t key_hash;
+    /// Next item in the same cancel index bucket.
+    SchedulerItem *index_next;
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+    /// Next item in the same wheel slot.
+    SchedulerItem *wheel_next;
+    /// Pointer to the link pointing at this item, nullptr if the item isn't filed in the wheel.
+    SchedulerItem **wheel_pprev;
+    /// Full (64-bit) time the item is due at, fixed when it's filed.
+    uint64_t wheel_deadline;
+    uint8_t wheel_level;
+    uint8_t wheel_slot;
+#endif
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
     inline uint8_t next_execution_major() {
@@ -50,6 +90,15 @@ class Scheduler {
       return next_exec_major;
     }
 
+    /// The poller of a PollingComponent is the interval named "update", it counts as update() in profiles.
+    ComponentActivity get_activity() const {
+#ifdef USE_COMPONENT_PROFILING
+      if (this->type == SchedulerItem::INTERVAL && this->name == "update")
+        return ComponentActivity::UPDATE;
+#endif
+      return ComponentActivity::SCHEDULER;
+    }
+
     static bool cmp(const std::unique_ptr<SchedulerItem> &a, const std::unique_ptr<SchedulerItem> &b);
     const char *get_type_str() {
       switch (this->type) {
@@ -64,21 +113,70 @@ class Scheduler {
   };
 
   uint32_t millis_();
-  void cleanup_();
-  void pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
   bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
+  // The following helpers must be called with `lock_` held.
+  std::unique_ptr<SchedulerItem> new_item_();
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
+  void index_insert_(SchedulerItem *item);
+  void index_remove_(SchedulerItem *item);
+  SchedulerItem *index_find_(Component *component, const std::string &name, SchedulerItem::Type type, uint32_t hash);
+  /// Finish up an item after its callback ran: drop it, or queue it again if it's an interval.
+  void retire_item_(std::unique_ptr<SchedulerItem> item, uint32_t now);
+#ifdef USE_COMPONENT_PROFILING
+  void record_lateness_(SchedulerItem *item, uint32_t now);
+#endif
+
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  static const uint8_t WHEEL_LEVELS = 5;
+  static const uint8_t WHEEL_SLOT_BITS = 5;
+  static const uint8_t WHEEL_SLOTS = 1 << WHEEL_SLOT_BITS;
+
+  uint64_t millis_full_(uint32_t now) const { return (uint64_t(this->millis_major_) << 32) | now; }
+  uint64_t wheel_deadline_(SchedulerItem *item) const;
+  // The following helpers must be called with `lock_` held.
+  void wheel_insert_(std::unique_ptr<SchedulerItem> item);
+  std::unique_ptr<SchedulerItem> wheel_unlink_(SchedulerItem *item);
+  SchedulerItem *wheel_next_slot_(uint8_t level, uint64_t *start) const;
+  /// Time of the next slot that needs to be entered, this is a lower bound for the next deadline.
+  uint64_t wheel_next_event_() const;
+  uint64_t wheel_next_deadline_() const;
+  void wheel_advance_(uint64_t now);
+#else
+  void cleanup_();
+  void pop_raw_();
   bool empty_() {
     this->cleanup_();
     return this->items_.empty();
   }
+#endif
 
   Mutex lock_;
+#ifdef USE_SCHEDULER_TIMING_WHEEL
+  /// Slot lists per wheel level; level N has a resolution of 2^(N * WHEEL_SLOT_BITS) ms.
+  SchedulerItem *wheel_[WHEEL_LEVELS][WHEEL_SLOTS]{};
+  /// Bitmask of non-empty slots per level.
+  uint32_t wheel_occupied_[WHEEL_LEVELS]{};
+  /// Everything due before this (full) time has been taken out of the wheel.
+  uint64_t wheel_time_{0};
+  uint32_t wheel_count_{0};
+  /// Items that are due and will run on the next call(), including all intervals of 0 ms.
+  std::vector<std::unique_ptr<SchedulerItem>> ready_;
+#else
   std::vector<std::unique_ptr<SchedulerItem>> items_;
+#endif
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  /// Retired items kept around for reuse, so steady-state rescheduling doesn't hit the heap.
+  std::vector<std::unique_ptr<SchedulerItem>> pool_;
+  /// Hash buckets (power-of-two sized) of all live named items, chained through SchedulerItem::index_next.
+  std::vector<SchedulerItem *> index_;
+  uint32_t index_count_{0};
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
+#ifdef USE_COMPONENT_PROFILING
+  TimingStats lateness_;
+#endif
 };
 
 }  // namespace esphome
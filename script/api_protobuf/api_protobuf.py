@@ -52,6 +52,15 @@ def indent(text, padding="  "):
     return "\n".join(indent_list(text, padding))
 
 
+def varint_size(value):
+    # Number of bytes of the protobuf varint encoding of value
+    size = 1
+    while value >= 0x80:
+        value >>= 7
+        size += 1
+    return size
+
+
 def camel_to_snake(name):
     # https://stackoverflow.com/a/1176023
     s1 = re.sub("(.)([A-Z][a-z]+)", r"\1_\2", name)
@@ -176,6 +185,24 @@ class TypeInfo(ABC):
 
     encode_func = None
 
+    @property
+    def field_id_size(self):
+        # Size of the field key, the wire type bits don't change it
+        return varint_size(self.number << 3)
+
+    def get_size_calculation(self, name: str, force: bool = False) -> str:
+        """C++ statement adding the encoded size of field `name` to `total_size`."""
+        return (
+            f"ProtoSize::{self.size_func}(total_size, {self.field_id_size}, "
+            f"{name}, {str(force).lower()});"
+        )
+
+    size_func = None
+
+    @property
+    def size_content(self):
+        return self.get_size_calculation(f"this->{self.field_name}")
+
     @property
     def dump_content(self):
         o = f'out.append("  {self.name}: ");\n'
@@ -206,6 +233,8 @@ class DoubleType(TypeInfo):
     decode_64bit = "value.as_double()"
     encode_func = "encode_double"
 
+    size_func = "add_double_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
         o += "out.append(buffer);"
@@ -219,6 +248,8 @@ class FloatType(TypeInfo):
     decode_32bit = "value.as_float()"
     encode_func = "encode_float"
 
+    size_func = "add_float_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
         o += "out.append(buffer);"
@@ -232,6 +263,8 @@ class Int64Type(TypeInfo):
     decode_varint = "value.as_int64()"
     encode_func = "encode_int64"
 
+    size_func = "add_int64_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
         o += "out.append(buffer);"
@@ -245,6 +278,8 @@ class UInt64Type(TypeInfo):
     decode_varint = "value.as_uint64()"
     encode_func = "encode_uint64"
 
+    size_func = "add_uint64_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%llu", {name});\n'
         o += "out.append(buffer);"
@@ -258,6 +293,8 @@ class Int32Type(TypeInfo):
     decode_varint = "value.as_int32()"
     encode_func = "encode_int32"
 
+    size_func = "add_int32_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
         o += "out.append(buffer);"
@@ -271,6 +308,8 @@ class Fixed64Type(TypeInfo):
     decode_64bit = "value.as_fixed64()"
     encode_func = "encode_fixed64"
 
+    size_func = "add_fixed64_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%llu", {name});\n'
         o += "out.append(buffer);"
@@ -284,6 +323,8 @@ class Fixed32Type(TypeInfo):
     decode_32bit = "value.as_fixed32()"
     encode_func = "encode_fixed32"
 
+    size_func = "add_fixed32_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRIu32, {name});\n'
         o += "out.append(buffer);"
@@ -297,6 +338,8 @@ class BoolType(TypeInfo):
     decode_varint = "value.as_bool()"
     encode_func = "encode_bool"
 
+    size_func = "add_bool_field"
+
     def dump(self, name):
         o = f"out.append(YESNO({name}));"
         return o
@@ -311,6 +354,8 @@ class StringType(TypeInfo):
     decode_length = "value.as_string()"
     encode_func = "encode_string"
 
+    size_func = "add_string_field"
+
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
         return o
@@ -340,6 +385,8 @@ class MessageType(TypeInfo):
     def decode_length(self):
         return f"value.as_message<{self.cpp_type}>()"
 
+    size_func = "add_message_object"
+
     def dump(self, name):
         o = f"{name}.dump_to(out);"
         return o
@@ -354,6 +401,8 @@ class BytesType(TypeInfo):
     decode_length = "value.as_string()"
     encode_func = "encode_string"
 
+    size_func = "add_string_field"
+
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
         return o
@@ -366,6 +415,8 @@ class UInt32Type(TypeInfo):
     decode_varint = "value.as_uint32()"
     encode_func = "encode_uint32"
 
+    size_func = "add_uint32_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRIu32, {name});\n'
         o += "out.append(buffer);"
@@ -388,6 +439,8 @@ class EnumType(TypeInfo):
     def encode_func(self):
         return f"encode_enum<{self.cpp_type}>"
 
+    size_func = "add_enum_field"
+
     def dump(self, name):
         o = f"out.append(proto_enum_to_string<{self.cpp_type}>({name}));"
         return o
@@ -400,6 +453,8 @@ class SFixed32Type(TypeInfo):
     decode_32bit = "value.as_sfixed32()"
     encode_func = "encode_sfixed32"
 
+    size_func = "add_fixed32_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
         o += "out.append(buffer);"
@@ -413,6 +468,8 @@ class SFixed64Type(TypeInfo):
     decode_64bit = "value.as_sfixed64()"
     encode_func = "encode_sfixed64"
 
+    size_func = "add_fixed64_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
         o += "out.append(buffer);"
@@ -426,6 +483,8 @@ class SInt32Type(TypeInfo):
     decode_varint = "value.as_sint32()"
     encode_func = "encode_sint32"
 
+    size_func = "add_sint32_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%" PRId32, {name});\n'
         o += "out.append(buffer);"
@@ -439,6 +498,8 @@ class SInt64Type(TypeInfo):
     decode_varint = "value.as_sint64()"
     encode_func = "encode_sint64"
 
+    size_func = "add_sint64_field"
+
     def dump(self, name):
         o = f'sprintf(buffer, "%lld", {name});\n'
         o += "out.append(buffer);"
@@ -526,6 +587,13 @@ class RepeatedTypeInfo(TypeInfo):
         o += "}"
         return o
 
+    @property
+    def size_content(self):
+        o = f"for (const auto {'' if self._ti_is_bool else '&'}it : this->{self.field_name}) {{\n"
+        o += f"  {self._ti.get_size_calculation('it', True)}\n"
+        o += "}"
+        return o
+
     @property
     def dump_content(self):
         o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
@@ -564,11 +632,15 @@ def build_enum_type(desc):
 def build_message_type(desc):
     public_content = []
     protected_content = []
+    id_ = get_opt(desc, pb.id)
+    if id_ is not None:
+        public_content.append(f"static constexpr uint16_t MESSAGE_TYPE = {id_};")
     decode_varint = []
     decode_length = []
     decode_32bit = []
     decode_64bit = []
     encode = []
+    size = []
     dump = []
 
     for field in desc.field:
@@ -579,6 +651,7 @@ def build_message_type(desc):
         protected_content.extend(ti.protected_content)
         public_content.extend(ti.public_content)
         encode.append(ti.encode_content)
+        size.append(ti.size_content)
 
         if ti.decode_varint_content:
             decode_varint.append(ti.decode_varint_content)
@@ -645,6 +718,18 @@ def build_message_type(desc):
     prot = "void encode(ProtoWriteBuffer buffer) const override;"
     public_content.append(prot)
 
+    o = f"void {desc.name}::calculate_size(uint32_t &total_size) const {{"
+    if size:
+        if len(size) == 1 and len(size[0]) + len(o) + 3 < 120:
+            o += f" {size[0]} "
+        else:
+            o += "\n"
+            o += indent("\n".join(size)) + "\n"
+    o += "}\n"
+    cpp += o
+    prot = "void calculate_size(uint32_t &total_size) const override;"
+    public_content.append(prot)
+
     o = f"void {desc.name}::dump_to(std::string &out) const {{"
     if dump:
         if len(dump) == 1 and len(dump[0]) + len(o) + 3 < 120:
@@ -0,0 +1,125 @@
+"""Tests for decoding the compact log messages of the native API."""
+
+import struct
+
+import pytest
+
+from esphome.components.api.log_decoder import (
+    LOG_RECORD_DEFINITION,
+    LOG_RECORD_MESSAGE,
+    LogDecoder,
+    format_args,
+)
+
+
+def _varint(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def _pack(*args):
+    """Pack arguments the way pack_log_args does on the device."""
+    out = b""
+    for kind, value in args:
+        if kind == "int":
+            # zigzag, like pack_signed
+            out += _varint(((value << 1) ^ (value >> 63)) & ((1 << 64) - 1))
+        elif kind == "uint":
+            out += _varint(value)
+        elif kind == "float":
+            out += struct.pack("<d", value)
+        else:
+            out += value.encode() + b"\0"
+    return out
+
+
+@pytest.mark.parametrize(
+    "fmt, args, expected",
+    (
+        ("no arguments", (), "no arguments"),
+        ("%d and %i", (("int", -42), ("int", 7)), "-42 and 7"),
+        ("%u %x %X %o", (("uint", 300),) * 4, "300 12c 12C 454"),
+        ("%lld", (("int", -(1 << 40)),), str(-(1 << 40))),
+        ("%hhd %hhu", (("int", 200), ("uint", 257)), "-56 1"),
+        ("%hd", (("int", 40000),), "-25536"),
+        ("%.2f|%8.3f|%e", (("float", 3.14159),) * 3, "3.14|   3.142|3.141590e+00"),
+        ("'%s' '%-6s'", (("str", "abc"), ("str", "de")), "'abc' 'de    '"),
+        ("%c%c", (("int", ord("o")), ("int", ord("k"))), "ok"),
+        (
+            "%*d|%-*d|%.*f",
+            (
+                ("int", 5),
+                ("int", 12),
+                ("int", 4),
+                ("int", 3),
+                ("int", 1),
+                ("float", 2.25),
+            ),
+            "   12|3   |2.2",
+        ),
+        ("100%%", (), "100%"),
+        ("%05d %+d", (("int", 42), ("int", 5)), "00042 +5"),
+        ("%p", (("uint", 0x3FFB0000),), "0x3ffb0000"),
+    ),
+)
+def test_format_args(fmt, args, expected):
+    """
+    Arguments packed like the device does print like printf
+    """
+    assert format_args(fmt.encode(), _pack(*args)) == expected
+
+
+def test_format_args_matches_python_formatting():
+    """
+    Every supported conversion decodes to the same text as %-formatting
+    """
+    cases = (
+        ("%d", ("int", -123456)),
+        ("%u", ("uint", 123456)),
+        ("%x", ("uint", 0xBEEF)),
+        ("%.3f", ("float", -0.125)),
+        ("%s", ("str", "sensor.temperature")),
+    )
+    for fmt, arg in cases:
+        assert format_args(fmt.encode(), _pack(arg)) == fmt % arg[1]
+
+
+def test_decode_round_trip():
+    """
+    A definition followed by a message decodes to the line the device prints
+    """
+    decoder = LogDecoder()
+    definition = (
+        bytes([LOG_RECORD_DEFINITION])
+        + _varint(300)
+        + _varint(1234)
+        + b"sensor\0"
+        + b"'%s': Sending state %.2f %s with %d decimals\0"
+    )
+    args = _pack(("str", "Temp"), ("float", 21.456), ("str", "C"), ("int", 2))
+    message = bytes([LOG_RECORD_MESSAGE]) + _varint(300) + args
+
+    assert decoder.decode(5, definition + message) == (
+        "\033[0;36m[D][sensor:1234]: 'Temp': Sending state 21.46 C with 2 decimals\033[0m"
+    )
+    # The definition is remembered for later messages
+    assert decoder.decode(3, message) == (
+        "\033[0;32m[I][sensor:1234]: 'Temp': Sending state 21.46 C with 2 decimals\033[0m"
+    )
+
+
+def test_decode_undefined_index():
+    """
+    A message whose index was never defined can't be decoded
+    """
+    decoder = LogDecoder()
+    message = bytes([LOG_RECORD_MESSAGE]) + _varint(5) + _pack(("int", 1))
+
+    assert decoder.decode(5, message) is None
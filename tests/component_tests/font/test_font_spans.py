@@ -0,0 +1,133 @@
+"""Tests for the glyph span encoding of the font component."""
+
+import random
+
+import pytest
+
+from esphome.components.font import (
+    SPAN_END_ROW,
+    SPAN_MAX_LENGTH,
+    SPAN_SHADED,
+    SPAN_SKIP,
+    SPAN_SKIP_SOLID,
+    SPAN_SOLID,
+    encode_glyph_spans,
+)
+
+SPAN_KIND_MASK = 0xC0
+SPAN_LENGTH_MASK = 0x3F
+
+
+def decode_glyph_spans(data, width, height, max_value):
+    """Decode spans into rows of pixel values the way Font::print does."""
+    rows = [[0] * width for _ in range(height)]
+    pos = 0
+    x = 0
+    row = 0
+    while row != height:
+        span = data[pos]
+        pos += 1
+        length = (span & SPAN_LENGTH_MASK) + 1
+        kind = span & SPAN_KIND_MASK
+        if kind == SPAN_SKIP:
+            x += length
+        elif kind == SPAN_SOLID:
+            rows[row][x : x + length] = [max_value] * length
+            x += length
+        elif kind == SPAN_SHADED:
+            rows[row][x : x + length] = data[pos : pos + length]
+            pos += length
+            x += length
+        elif span == SPAN_END_ROW:
+            x = 0
+            row += 1
+        else:
+            solid = (span & 0x07) + 1
+            x += (span >> 3) & 0x07
+            rows[row][x : x + solid] = [max_value] * solid
+            x += solid
+        assert x <= width
+    assert pos == len(data)
+    return rows
+
+
+def _round_trip(rows, max_value):
+    data = encode_glyph_spans(rows, max_value)
+    assert all(0 <= byte <= 0xFF for byte in data)
+    width = len(rows[0]) if rows else 0
+    assert decode_glyph_spans(data, width, len(rows), max_value) == rows
+    return data
+
+
+@pytest.mark.parametrize(
+    "rows",
+    [
+        # empty rows
+        [[0, 0, 0], [0, 0, 0]],
+        # short skip and solid pair
+        [[0, 0, 1, 1, 1, 0], [1, 1, 1, 1, 1, 1]],
+        # skip and solid runs longer than one span
+        [[0] * 100 + [1] * 150],
+        # solid run too long for the short form
+        [[0, 0] + [1] * 20 + [0, 1]],
+    ],
+)
+def test_encode_glyph_spans__one_bit(rows):
+    """Monochrome glyphs decode back to their bitmap."""
+    # Given / When
+    data = _round_trip(rows, 1)
+
+    # Then
+    assert SPAN_SHADED not in {byte & SPAN_KIND_MASK for byte in data}
+
+
+def test_encode_glyph_spans__short_form():
+    """A short skip followed by a short solid run is encoded in a single byte."""
+    # Given
+    rows = [[0, 0, 0, 1, 1, 0]]
+
+    # When
+    data = _round_trip(rows, 1)
+
+    # Then
+    assert data == [SPAN_SKIP_SOLID | 3 << 3 | 1, SPAN_END_ROW]
+
+
+def test_encode_glyph_spans__shaded():
+    """Antialiased glyphs decode back to their pixel values."""
+    # Given
+    rows = [
+        [0, 3, 15, 15, 7, 0, 0],
+        [15, 15, 15, 15, 15, 15, 15],
+        [0, 0, 1, 0, 2, 15, 0],
+        [8] * SPAN_MAX_LENGTH * 2 + [0, 15],
+    ]
+    width = max(len(row) for row in rows)
+    rows = [row + [0] * (width - len(row)) for row in rows]
+
+    # When / Then
+    _round_trip(rows, 15)
+
+
+@pytest.mark.parametrize("max_value", [1, 3, 15, 255])
+def test_encode_glyph_spans__random(max_value):
+    """Random bitmaps of every depth decode back to the source bitmap."""
+    # Given
+    rng = random.Random(max_value)
+
+    def pixel():
+        # mostly transparent and solid pixels like real glyphs
+        kind = rng.random()
+        if kind < 0.5:
+            return 0
+        if kind < 0.8:
+            return max_value
+        return rng.randint(0, max_value)
+
+    for _ in range(200):
+        width = rng.randint(1, 150)
+        height = rng.randint(1, 12)
+        rows = [[pixel() for _ in range(width)] for _ in range(height)]
+
+        # When / Then
+        _round_trip(rows, max_value)
@@ -0,0 +1,94 @@
+"""Tests for the run-length encoding of compressed images."""
+
+import random
+
+import pytest
+
+from esphome.components.image import RLE_MAX_LENGTH, encode_rle
+
+
+def decode_rle(encoded, stride, height, unit):
+    """Decode the rows of an image the way Image::read_row_ does."""
+    data = []
+    pos = 0
+    for _ in range(height):
+        line = []
+        while len(line) < stride:
+            header = encoded[pos]
+            pos += 1
+            size = min(((header & 0x7F) + 1) * unit, stride - len(line))
+            if header & 0x80:
+                value = encoded[pos : pos + unit]
+                line += (value * (size // unit + 1))[:size]
+                pos += unit
+            else:
+                line += encoded[pos : pos + size]
+                pos += size
+        data += line
+    assert pos == len(encoded)
+    return data
+
+
+def _round_trip(data, stride, unit):
+    encoded = encode_rle(data, stride, unit)
+    assert all(0 <= byte <= 0xFF for byte in encoded)
+    assert decode_rle(encoded, stride, len(data) // stride, unit) == data
+    return encoded
+
+
+@pytest.mark.parametrize("unit", [1, 2, 3, 4])
+def test_encode_rle__runs(unit):
+    """Rows of long runs shrink and decode back to the source pixels."""
+    # Given
+    stride = 300 * unit
+    pixel = list(range(1, unit + 1))
+    row = pixel * 300
+    other = [0xFF] * unit * 150 + pixel * 150
+
+    # When
+    encoded = _round_trip(row + other, stride, unit)
+
+    # Then
+    assert len(encoded) < len(row)
+
+
+def test_encode_rle__rows_are_separate():
+    """A run never continues into the next row."""
+    # Given
+    data = [7] * 10
+
+    # When
+    encoded = _round_trip(data, 5, 1)
+
+    # Then
+    assert encoded == [0x84, 7, 0x84, 7]
+
+
+def test_encode_rle__literals():
+    """Pixels that don't repeat are kept as literals, split at the longest header."""
+    # Given
+    data = [i & 0xFF for i in range(RLE_MAX_LENGTH * 2 + 5)]
+
+    # When
+    encoded = _round_trip(data, len(data), 1)
+
+    # Then
+    assert encoded[0] == RLE_MAX_LENGTH - 1
+
+
+@pytest.mark.parametrize("unit", [1, 2, 3, 4])
+def test_encode_rle__random(unit):
+    """Random images of every pixel size decode back to the source pixels."""
+    # Given
+    rng = random.Random(unit)
+    for _ in range(100):
+        width = rng.randint(1, 300)
+        height = rng.randint(1, 8)
+        # a few colors, so there are runs of every length
+        colors = [[rng.randint(0, 255) for _ in range(unit)] for _ in range(3)]
+        data = []
+        for _ in range(width * height):
+            data += rng.choice(colors)
+
+        # When / Then
+        _round_trip(data, width * unit, unit)
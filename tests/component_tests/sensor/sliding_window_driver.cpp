@@ -0,0 +1,47 @@
+// Runs the sliding windows of the sensor filters for test_sliding_window.py.
+//
+// Usage: sliding_window_driver <window size> <quantile>...
+// Reads "w <window size>" and "v <value>" lines from stdin. For each value it prints the median, the quantiles, the
+// minimum and the maximum of the window, as hex floats.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+#include "esphome/components/sensor/sliding_window.h"
+
+using esphome::sensor::SlidingWindowExtremum;
+using esphome::sensor::SortedSlidingWindow;
+
+int main(int argc, char **argv) {
+  if (argc < 2)
+    return 2;
+  const size_t window_size = strtoul(argv[1], nullptr, 10);
+  std::vector<float> quantiles;
+  for (int i = 2; i < argc; i++)
+    quantiles.push_back(strtof(argv[i], nullptr));
+
+  SortedSlidingWindow sorted(window_size);
+  SlidingWindowExtremum<std::less<float>> min(window_size);
+  SlidingWindowExtremum<std::greater<float>> max(window_size);
+
+  char line[64];
+  while (fgets(line, sizeof(line), stdin) != nullptr) {
+    if (line[0] == 'w') {
+      const size_t size = strtoul(line + 2, nullptr, 10);
+      sorted.set_window_size(size);
+      min.set_window_size(size);
+      max.set_window_size(size);
+      continue;
+    }
+    const float value = strtof(line + 2, nullptr);
+    sorted.push(value);
+    min.push(value);
+    max.push(value);
+    printf("%a", sorted.median());
+    for (float quantile : quantiles)
+      printf(" %a", sorted.quantile(quantile));
+    printf(" %a %a\n", min.value(), max.value());
+  }
+  return 0;
+}
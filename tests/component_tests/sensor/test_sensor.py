@@ -12,3 +12,39 @@ def test_sensor_device_class_set(generate_main):
 
     # Then
     assert 's_1->set_device_class("voltage");' in main_cpp
+
+
+def test_sensor_stateless_filters_fused(generate_main):
+    """
+    A run of stateless filters becomes one StatelessFilter that runs every filter
+    with its own float operations, in the configured order
+    """
+    # Given
+
+    # When
+    main_cpp = generate_main("tests/component_tests/sensor/test_sensor_filters.yaml")
+
+    # Then
+    assert main_cpp.count("new sensor::StatelessFilter(") == 1
+    offset = main_cpp.index("x = x + 2.0f;")
+    multiply = main_cpp.index("x = x * 3.0f;")
+    calibrate = main_cpp.index("x = x * 2.0f + 1.0f;")
+    assert offset < multiply < calibrate
+    # Offsets and multipliers aren't folded together, that could change the result
+    assert "x = x * 6.0f" not in main_cpp
+    assert "new sensor::OffsetFilter(2.0f)" not in main_cpp
+
+
+def test_sensor_single_stateless_filters_not_fused(generate_main):
+    """
+    Stateless filters separated by a stateful filter are built as their own filters
+    """
+    # Given
+
+    # When
+    main_cpp = generate_main("tests/component_tests/sensor/test_sensor_filters.yaml")
+
+    # Then
+    assert "new sensor::OffsetFilter(1.5f)" in main_cpp
+    assert "new sensor::SlidingWindowMovingAverageFilter(5, 5, 1)" in main_cpp
+    assert "new sensor::MultiplyFilter(0.5f)" in main_cpp
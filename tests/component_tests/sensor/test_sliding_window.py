@@ -0,0 +1,168 @@
+"""Tests for the sliding windows of the median, quantile, min and max filters.
+
+The windows are built on the host and compared with the filters they replaced, which kept the window in a deque and
+sorted or scanned a copy of it for every value.
+"""
+
+from collections import deque
+import math
+from pathlib import Path
+import random
+import shutil
+import struct
+import subprocess
+
+import pytest
+
+here = Path(__file__).parent
+package_root = here.parent.parent.parent
+QUANTILES = [0.1, 0.25, 0.5, 0.9, 1.0]
+
+
+def f32(value):
+    """Round to the nearest float like the C++ code does."""
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+class DequeFilters:
+    """The median, quantile, min and max filters as they were before the sliding windows."""
+
+    def __init__(self, window_size):
+        self.window_size = window_size
+        self.queue = deque()
+
+    def push(self, value):
+        while len(self.queue) >= self.window_size:
+            self.queue.popleft()
+        self.queue.append(value)
+        valid = sorted(v for v in self.queue if not math.isnan(v))
+        if not valid:
+            return [math.nan] * (len(QUANTILES) + 3)
+        count = len(valid)
+        if count % 2:
+            median = valid[count // 2]
+        else:
+            median = f32(f32(valid[count // 2] + valid[count // 2 - 1]) / 2)
+        quantiles = [
+            valid[math.ceil(f32(count * f32(quantile))) - 1] for quantile in QUANTILES
+        ]
+        return [median, *quantiles, valid[0], valid[-1]]
+
+
+@pytest.fixture(scope="module")
+def driver(tmp_path_factory):
+    """Build the driver that runs the C++ windows."""
+    compiler = shutil.which("g++")
+    if compiler is None:
+        pytest.skip("g++ is needed to build the sliding windows")
+    path = tmp_path_factory.mktemp("sliding_window") / "driver"
+    subprocess.run(
+        [
+            compiler,
+            "-std=gnu++17",
+            f"-I{package_root}",
+            str(here / "sliding_window_driver.cpp"),
+            str(package_root / "esphome/components/sensor/sliding_window.cpp"),
+            "-o",
+            str(path),
+        ],
+        check=True,
+    )
+    return path
+
+
+def _run(driver, window_size, ops):
+    """Run the C++ windows and the deque filters over ops and compare every output."""
+    reference = DequeFilters(window_size)
+    lines = []
+    expected = []
+    for op, arg in ops:
+        if op == "w":
+            reference.window_size = arg
+            lines.append(f"w {arg}")
+        else:
+            value = f32(arg)
+            lines.append(f"v {value.hex()}")
+            expected.append(reference.push(value))
+
+    result = subprocess.run(
+        [str(driver), str(window_size), *(str(q) for q in QUANTILES)],
+        input="\n".join(lines) + "\n",
+        capture_output=True,
+        text=True,
+        check=True,
+    )
+    outputs = [
+        [float.fromhex(field) for field in line.split()]
+        for line in result.stdout.splitlines()
+    ]
+    assert len(outputs) == len(expected)
+    for step, (output, values) in enumerate(zip(outputs, expected)):
+        assert all(
+            (math.isnan(a) and math.isnan(b)) or a == b for a, b in zip(output, values)
+        ), f"step {step}: got {output}, expected {values}"
+
+
+def test_sliding_window__fills_and_slides(driver):
+    """A window that fills up and then slides over increasing values."""
+    # Given
+    ops = [("v", float(i)) for i in range(20)]
+
+    # When / Then
+    _run(driver, 5, ops)
+
+
+def test_sliding_window__duplicates(driver):
+    """Duplicate values leave the window one at a time."""
+    # Given
+    values = [3, 3, 1, 3, 1, 1, 2, 2, 2, 3, 3, 3, 3, 1, 2, 1, 1, 1, 3, 2]
+    ops = [("v", float(v)) for v in values * 3]
+
+    # When / Then
+    for window_size in (1, 2, 3, 4, 7):
+        _run(driver, window_size, ops)
+
+
+def test_sliding_window__nan(driver):
+    """NaN values take a place in the window but are left out of every result."""
+    # Given
+    values = [math.nan, 1.0, math.nan, math.nan, 2.0, math.nan, math.nan, math.nan]
+    ops = [("v", v) for v in values * 2]
+
+    # When / Then
+    _run(driver, 3, ops)
+
+
+def test_sliding_window__resize(driver):
+    """Growing and shrinking the window keeps the newest values."""
+    # Given
+    ops = [("v", float(i % 7)) for i in range(10)]
+    ops += [("w", 3)] + [("v", float(i % 5)) for i in range(4)]
+    ops += [("w", 8)] + [("v", float(i % 4)) for i in range(12)]
+    ops += [("w", 1), ("v", 9.0), ("w", 4), ("v", 1.0), ("v", 1.0)]
+
+    # When / Then
+    _run(driver, 6, ops)
+
+
+@pytest.mark.parametrize("seed", range(20))
+def test_sliding_window__random(driver, seed):
+    """Random values with duplicates, NaNs and window changes."""
+    # Given
+    rng = random.Random(seed)
+    window_size = rng.randint(1, 40)
+    choices = [rng.uniform(-100, 100) for _ in range(rng.randint(1, 10))]
+    ops = []
+    for _ in range(500):
+        kind = rng.random()
+        if kind < 0.02:
+            ops.append(("w", rng.randint(1, 40)))
+        elif kind < 0.1:
+            ops.append(("v", math.nan))
+        elif kind < 0.5:
+            ops.append(("v", rng.choice(choices)))
+        else:
+            ops.append(("v", rng.uniform(-100, 100)))
+
+    # When / Then
+    _run(driver, window_size, ops)